@@ -0,0 +1,1294 @@
+/*!
+ * \file cmor_bench.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Benchmark suite for the library's hot paths, reporting machine-readable JSON.
+ * \remarks Every benchmark runs for each type in \ref TYPE_ITERATOR (or the subset an API supports)
+ * and for each size in the sweep. Results go to stdout as one JSON document, progress to stderr,
+ * so two builds can be compared with any JSON diffing tool.
+ *
+ * Each result reports the median and minimum of several timed samples. Iteration counts are
+ * calibrated so one sample lasts at least min-time / samples. Benchmarks that mutate their input
+ * (the sorts) restore it before every call. The cost of the restore is timed separately and subtracted.
+ * cycles_per_op counts timestamp-counter ticks on x86 and is null elsewhere.
+ *
+ * Usage: cmor_bench [--min-time-ms N] [--sizes N,N,...] [--threads N] [--filter SUBSTRING]
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L // clock_gettime, mkstemp
+
+#include "array.h"
+#include "binaryio.h"
+#include "bitpack.h"
+#include "bitconverter.h"
+#include "bitops.h"
+#include "hash.h"
+#include "magazine.h"
+#include "mappedfile.h"
+#include "mempool.h"
+#include "quaternion.h"
+#include "slab.h"
+#include "queue.h"
+#include "stack.h"
+#include "textcodec.h"
+#include "varint.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#define BENCH_HAS_TSC 1
+#else
+#define BENCH_HAS_TSC 0
+#endif
+
+#ifndef CMOR_BENCH_BUILD_TYPE
+#define CMOR_BENCH_BUILD_TYPE ""
+#endif
+
+#define BENCH_SAMPLES 5 //!< timed samples per benchmark; the median is reported
+#define BENCH_MAX_SIZES 32 //!< maximum number of entries in --sizes
+#define BENCH_CONV_TAPS 32 //!< kernel length used by the convolution benchmark
+#define BENCH_POOL_BLOCK 64 //!< block size used by the memory pool benchmark
+
+typedef struct {
+    double minTimeNs; //!< target wall time per benchmark
+    size_t sizes[BENCH_MAX_SIZES]; //!< element counts to sweep
+    size_t sizeCount; //!< number of entries in sizes
+    unsigned threads; //!< thread count handed to the parallel sort
+    const char *filter; //!< only run benchmarks whose name contains this, or all if NULL
+    bool first; //!< no result has been printed yet (JSON comma handling)
+    bool failed; //!< a benchmark's self-check failed; the exit status reports it
+} BenchConfig;
+
+typedef struct {
+    const char *name; //!< benchmark name, usually the function under test
+    const char *type; //!< element type
+    size_t size; //!< items processed per call
+    size_t itemBytes; //!< bytes per item, for throughput
+    void (*reset)(void *ctx); //!< restores the input before each call, or NULL
+    void (*run)(void *ctx); //!< the operation being measured
+    void *ctx; //!< state shared by reset and run
+} BenchCase;
+
+static uint64_t g_seed = 0x9E3779B97F4A7C15u;
+
+static uint64_t bench_rand(void) {
+    // xorshift64*: fast, deterministic, and good enough for benchmark inputs
+    g_seed ^= g_seed >> 12;
+    g_seed ^= g_seed << 25;
+    g_seed ^= g_seed >> 27;
+    return g_seed * 0x2545F4914F6CDD1Du;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint64_t now_cycles(void) {
+#if BENCH_HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void *bench_alloc(size_t bytes) {
+    void *p = malloc(bytes ? bytes : 1);
+    if (!p) {
+        fprintf(stderr, "cmor_bench: out of memory allocating %zu bytes\n", bytes);
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/*!
+ * \brief Times iters calls of run (each preceded by reset, if any).
+ */
+static void time_batch(const BenchCase *bc, size_t iters, bool withRun, double *ns, double *cycles) {
+    double t0 = now_ns();
+    uint64_t c0 = now_cycles();
+    for (size_t i = 0; i < iters; ++i) {
+        if (bc->reset) {
+            bc->reset(bc->ctx);
+        }
+        if (withRun) {
+            bc->run(bc->ctx);
+        }
+    }
+    *cycles = (double)(now_cycles() - c0);
+    *ns = now_ns() - t0;
+}
+
+/*!
+ * \brief Measures one benchmark case and prints its JSON record.
+ */
+static void bench_run(BenchConfig *cfg, const BenchCase *bc) {
+    if (cfg->filter && !strstr(bc->name, cfg->filter)) {
+        return;
+    }
+    fprintf(stderr, "%-24s %-12s %10zu\n", bc->name, bc->type, bc->size);
+
+    // calibrate: double the iteration count until one sample fills its share of the time budget
+    double target = cfg->minTimeNs / BENCH_SAMPLES;
+    size_t iters = 1;
+    double ns, cycles;
+    for (;;) {
+        time_batch(bc, iters, true, &ns, &cycles);
+        if (ns >= target || iters >= ((size_t)1 << 40)) {
+            break;
+        }
+        size_t grow = (ns > 0.0) ? (size_t)(1.2 * target / ns * (double)iters) : iters * 2;
+        iters = (grow > iters * 2) ? grow : iters * 2;
+    }
+
+    double samples[BENCH_SAMPLES], cyc[BENCH_SAMPLES];
+    for (int s = 0; s < BENCH_SAMPLES; ++s) {
+        time_batch(bc, iters, true, &samples[s], &cyc[s]);
+    }
+
+    // overhead of restoring the input, subtracted from every sample
+    double resetNs = 0.0, resetCycles = 0.0;
+    if (bc->reset) {
+        resetNs = -1.0;
+        for (int s = 0; s < BENCH_SAMPLES; ++s) {
+            time_batch(bc, iters, false, &ns, &cycles);
+            if (resetNs < 0.0 || ns < resetNs) {
+                resetNs = ns;
+                resetCycles = cycles;
+            }
+        }
+    }
+    for (int s = 0; s < BENCH_SAMPLES; ++s) {
+        samples[s] = (samples[s] > resetNs) ? (samples[s] - resetNs) / (double)iters : 0.0;
+        cyc[s] = (cyc[s] > resetCycles) ? (cyc[s] - resetCycles) / (double)iters : 0.0;
+    }
+    qsort(samples, BENCH_SAMPLES, sizeof samples[0], cmp_double);
+    qsort(cyc, BENCH_SAMPLES, sizeof cyc[0], cmp_double);
+
+    double median = samples[BENCH_SAMPLES / 2];
+    double items = (double)bc->size;
+    double perSec = (median > 0.0) ? items * 1e9 / median : 0.0;
+
+    printf("%s\n    {\"name\": \"%s\", \"type\": \"%s\", \"size\": %zu, \"iterations\": %zu, "
+           "\"ns_per_op\": %.3f, \"ns_per_op_min\": %.3f, \"ns_per_item\": %.4f, "
+           "\"items_per_sec\": %.1f, \"bytes_per_sec\": %.1f, ",
+           cfg->first ? "" : ",", bc->name, bc->type, bc->size, iters,
+           median, samples[0], (items > 0.0) ? median / items : 0.0,
+           perSec, perSec * (double)bc->itemBytes);
+    if (BENCH_HAS_TSC) {
+        printf("\"cycles_per_op\": %.1f}", cyc[BENCH_SAMPLES / 2]);
+    } else {
+        printf("\"cycles_per_op\": null}");
+    }
+    fflush(stdout);
+    cfg->first = false;
+}
+
+/*!
+ * \brief Fills an array with reproducible random values.
+ * \remarks Integers get uniformly random bits, floating types get values in [-1e6, 1e6).
+ * With small set, values stay in [0, 16) so integer convolutions cannot overflow.
+ */
+#define BENCH_FILL_DEFINE(T) \
+static void fill_##T(T dst[], size_t n, bool small) { \
+    for (size_t i = 0; i < n; ++i) { \
+        uint64_t r = bench_rand(); \
+        if (small) { \
+            dst[i] = (T)(r % 16); \
+        } else if ((T)0.5 != 0) { \
+            dst[i] = (T)((double)(r >> 11) * 0x1.0p-53 * 2e6 - 1e6); \
+        } else { \
+            memcpy(&dst[i], &r, sizeof dst[i]); \
+        } \
+    } \
+}
+
+    TYPE_ITERATOR(BENCH_FILL_DEFINE)
+
+#undef BENCH_FILL_DEFINE
+
+#define BENCH_SORT_CASES 6 //!< leading entries of the array cases that are full sorts
+
+/*!
+ * \brief Benchmarks for everything in array.h that takes one array of T.
+ * \remarks The full sorts run on random input, then again on sorted, reversed and all-equal input.
+ */
+#define BENCH_ARRAY_DEFINE(T) \
+typedef struct { \
+    T *data; \
+    T *src; \
+    T *temp; \
+    T *out; \
+    T *taps; \
+    void *scratch; \
+    size_t scratchSize; \
+    size_t len; \
+    unsigned threads; \
+    volatile double sink; \
+} ArrayBench_##T; \
+\
+static void restore_##T(void *p) { \
+    ArrayBench_##T *b = p; \
+    memcpy(b->data, b->src, b->len * sizeof(T)); \
+} \
+static void run_quick_sort_##T(void *p) { \
+    ArrayBench_##T *b = p; \
+    QuickSort_##T(b->data, 0, (int)b->len - 1); \
+} \
+static void run_merge_sort_##T(void *p) { \
+    ArrayBench_##T *b = p; \
+    MergeSort_##T(b->data, 0, (int)b->len - 1, b->temp); \
+} \
+static void run_array_sort_##T(void *p) { \
+    ArrayBench_##T *b = p; \
+    Array_Sort_##T(b->data, b->len); \
+} \
+static void run_natural_merge_sort_##T(void *p) { \
+    ArrayBench_##T *b = p; \
+    Array_MergeSort_##T(b->data, b->len, b->temp); \
+} \
+static void run_radix_sort_##T(void *p) { \
+    ArrayBench_##T *b = p; \
+    Array_RadixSort_##T(b->data, b->len, b->temp); \
+} \
+static void run_parallel_sort_##T(void *p) { \
+    ArrayBench_##T *b = p; \
+    ParallelMergeSort_##T(b->data, b->len, b->temp, b->threads); \
+} \
+static void run_nth_element_##T(void *p) { \
+    ArrayBench_##T *b = p; \
+    Array_NthElement_##T(b->data, b->len, b->len / 2); \
+} \
+static void run_avg_##T(void *p) { \
+    ArrayBench_##T *b = p; \
+    b->sink = Array_Avg_##T(b->src, b->len); \
+} \
+static void run_convolve_##T(void *p) { \
+    ArrayBench_##T *b = p; \
+    convolve_scratch_##T(b->src, b->len, b->taps, BENCH_CONV_TAPS, \
+                         b->out, b->len + BENCH_CONV_TAPS - 1, b->scratch, b->scratchSize); \
+} \
+\
+static void bench_array_##T(BenchConfig *cfg, size_t n) { \
+    ArrayBench_##T b = { 0 }; \
+    b.len = n; \
+    b.threads = cfg->threads; \
+    b.data = bench_alloc(n * sizeof(T)); \
+    b.src = bench_alloc(n * sizeof(T)); \
+    b.temp = bench_alloc(n * sizeof(T)); \
+    b.out = bench_alloc((n + BENCH_CONV_TAPS - 1) * sizeof(T)); \
+    b.taps = bench_alloc(BENCH_CONV_TAPS * sizeof(T)); \
+    b.scratchSize = convolve_scratch_size(n, BENCH_CONV_TAPS); \
+    b.scratch = b.scratchSize ? bench_alloc(b.scratchSize) : NULL; \
+    \
+    fill_##T(b.src, n, false); \
+    const BenchCase sorts[] = { \
+        { "QuickSort", #T, n, sizeof(T), restore_##T, run_quick_sort_##T, &b }, \
+        { "MergeSort", #T, n, sizeof(T), restore_##T, run_merge_sort_##T, &b }, \
+        { "Array_Sort", #T, n, sizeof(T), restore_##T, run_array_sort_##T, &b }, \
+        { "Array_MergeSort", #T, n, sizeof(T), restore_##T, run_natural_merge_sort_##T, &b }, \
+        { "Array_RadixSort", #T, n, sizeof(T), restore_##T, run_radix_sort_##T, &b }, \
+        { "ParallelMergeSort", #T, n, sizeof(T), restore_##T, run_parallel_sort_##T, &b }, \
+        { "Array_NthElement", #T, n, sizeof(T), restore_##T, run_nth_element_##T, &b }, \
+        { "Array_Avg", #T, n, sizeof(T), NULL, run_avg_##T, &b }, \
+    }; \
+    for (size_t i = 0; i < sizeof sorts / sizeof sorts[0]; ++i) { \
+        bench_run(cfg, &sorts[i]); \
+    } \
+    \
+    /* the sorts again on presorted, reversed and all-equal input, named e.g. Array_Sort/reversed */ \
+    static const char *const patterns[] = { "sorted", "reversed", "equal" }; \
+    Array_Sort_##T(b.src, n); \
+    for (size_t p = 0; p < sizeof patterns / sizeof patterns[0]; ++p) { \
+        if (p == 1) { \
+            for (size_t i = 0; i < n / 2; ++i) { \
+                swap_##T(&b.src[i], &b.src[n - 1 - i]); \
+            } \
+        } else if (p == 2) { \
+            for (size_t i = 1; i < n; ++i) { \
+                b.src[i] = b.src[0]; \
+            } \
+        } \
+        for (size_t i = 0; i < BENCH_SORT_CASES; ++i) { \
+            char name[64]; \
+            snprintf(name, sizeof name, "%s/%s", sorts[i].name, patterns[p]); \
+            BenchCase c = sorts[i]; \
+            c.name = name; \
+            bench_run(cfg, &c); \
+        } \
+    } \
+    \
+    fill_##T(b.src, n, true); \
+    fill_##T(b.taps, BENCH_CONV_TAPS, true); \
+    const BenchCase conv = { "convolve", #T, n, sizeof(T), NULL, run_convolve_##T, &b }; \
+    bench_run(cfg, &conv); \
+    \
+    free(b.data); \
+    free(b.src); \
+    free(b.temp); \
+    free(b.out); \
+    free(b.taps); \
+    free(b.scratch); \
+}
+
+    TYPE_ITERATOR(BENCH_ARRAY_DEFINE)
+
+#undef BENCH_ARRAY_DEFINE
+
+/*!
+ * \brief Benchmarks for the Queue and Stack containers with items of type T.
+ * \remarks One call fills the container with n items and drains it again.
+ */
+#define BENCH_CONTAINER_DEFINE(T) \
+typedef struct { \
+    Queue q; \
+    Stack s; \
+    const T *src; \
+    T *dst; \
+    size_t len; \
+} ContainerBench_##T; \
+\
+static void run_queue_##T(void *p) { \
+    ContainerBench_##T *b = p; \
+    for (size_t i = 0; i < b->len; ++i) { \
+        queue_enqueue(&b->q, &b->src[i]); \
+    } \
+    for (size_t i = 0; i < b->len; ++i) { \
+        queue_dequeue(&b->q, &b->dst[i]); \
+    } \
+} \
+static void run_stack_##T(void *p) { \
+    ContainerBench_##T *b = p; \
+    for (size_t i = 0; i < b->len; ++i) { \
+        stack_push(&b->s, &b->src[i]); \
+    } \
+    for (size_t i = 0; i < b->len; ++i) { \
+        stack_pop(&b->s, &b->dst[i]); \
+    } \
+} \
+\
+static void bench_container_##T(BenchConfig *cfg, size_t n) { \
+    if (n > (size_t)INT32_MAX) { \
+        return; \
+    } \
+    ContainerBench_##T b = { 0 }; \
+    T *src = bench_alloc(n * sizeof(T)); \
+    void *qbuf = bench_alloc(n * sizeof(T)); \
+    void *sbuf = bench_alloc(n * sizeof(T)); \
+    fill_##T(src, n, false); \
+    b.src = src; \
+    b.dst = bench_alloc(n * sizeof(T)); \
+    b.len = n; \
+    if (queue_init(&b.q, qbuf, n * sizeof(T), sizeof(T), (int)n) == QUEUE_SUCCESS && \
+        stack_init(&b.s, sbuf, n * sizeof(T), sizeof(T), (int)n) == STACK_SUCCESS) { \
+        const BenchCase queue = { "Queue_EnqueueDequeue", #T, n, sizeof(T), NULL, run_queue_##T, &b }; \
+        const BenchCase stack = { "Stack_PushPop", #T, n, sizeof(T), NULL, run_stack_##T, &b }; \
+        bench_run(cfg, &queue); \
+        bench_run(cfg, &stack); \
+    } \
+    free(src); \
+    free(qbuf); \
+    free(sbuf); \
+    free(b.dst); \
+}
+
+    TYPE_ITERATOR(BENCH_CONTAINER_DEFINE)
+
+#undef BENCH_CONTAINER_DEFINE
+
+/*!
+ * \brief Benchmarks for BitConverter round trips; SUF names the BitConverter overload for T.
+ */
+#define BENCH_BITCONV_DEFINE(SUF, T) \
+typedef struct { \
+    T *values; \
+    uint8_t *bytes; \
+    size_t len; \
+} BitConvBench_##T; \
+\
+static void run_get_bytes_##T(void *p) { \
+    BitConvBench_##T *b = p; \
+    for (size_t i = 0; i < b->len; ++i) { \
+        BitConverter_GetBytes_##SUF(b->values[i], &b->bytes[i * sizeof(T)]); \
+    } \
+} \
+static void run_to_##T(void *p) { \
+    BitConvBench_##T *b = p; \
+    for (size_t i = 0; i < b->len; ++i) { \
+        b->values[i] = BitConverter_To##SUF(&b->bytes[i * sizeof(T)]); \
+    } \
+} \
+\
+static void run_to_be_##T(void *p) { \
+    BitConvBench_##T *b = p; \
+    for (size_t i = 0; i < b->len; ++i) { \
+        b->values[i] = BitConverter_To##SUF##BE(&b->bytes[i * sizeof(T)]); \
+    } \
+} \
+static void run_reverse_array_##T(void *p) { \
+    BitConvBench_##T *b = p; \
+    BitConverter_ReverseArray_##SUF(b->values, b->values, b->len); \
+} \
+\
+static void bench_bitconv_##T(BenchConfig *cfg, size_t n) { \
+    BitConvBench_##T b = { bench_alloc(n * sizeof(T)), bench_alloc(n * sizeof(T)), n }; \
+    fill_##T(b.values, n, false); \
+    run_get_bytes_##T(&b); /* the To cases read bytes, even when --filter skips GetBytes */ \
+    const BenchCase get = { "BitConverter_GetBytes", #T, n, sizeof(T), NULL, run_get_bytes_##T, &b }; \
+    const BenchCase to = { "BitConverter_To", #T, n, sizeof(T), NULL, run_to_##T, &b }; \
+    const BenchCase toBE = { "BitConverter_ToBE", #T, n, sizeof(T), NULL, run_to_be_##T, &b }; \
+    const BenchCase rev = { "BitConverter_ReverseArray", #T, n, sizeof(T), NULL, run_reverse_array_##T, &b }; \
+    bench_run(cfg, &get); \
+    bench_run(cfg, &to); \
+    bench_run(cfg, &toBE); \
+    bench_run(cfg, &rev); \
+    free(b.values); \
+    free(b.bytes); \
+}
+
+#define BITCONV_TYPE_MAP(FMACRO) \
+    FMACRO(Int16, int16_t) \
+    FMACRO(Int32, int32_t) \
+    FMACRO(Int64, int64_t) \
+    FMACRO(UInt16, uint16_t) \
+    FMACRO(UInt32, uint32_t) \
+    FMACRO(UInt64, uint64_t) \
+    FMACRO(Float, float) \
+    FMACRO(Double, double)
+
+    BITCONV_TYPE_MAP(BENCH_BITCONV_DEFINE)
+
+#undef BENCH_BITCONV_DEFINE
+
+/*!
+ * \brief Benchmarks for the bulk float <-> binary16 / bfloat16 conversions.
+ */
+typedef struct {
+    float *values;
+    uint16_t *halves;
+    size_t len;
+} Float16Bench;
+
+static void run_half_from_float(void *p) {
+    Float16Bench *b = p;
+    BitConverter_HalfFromFloatArray(b->halves, b->values, b->len);
+}
+static void run_float_from_half(void *p) {
+    Float16Bench *b = p;
+    BitConverter_FloatFromHalfArray(b->values, b->halves, b->len);
+}
+static void run_bfloat16_from_float(void *p) {
+    Float16Bench *b = p;
+    BitConverter_BFloat16FromFloatArray(b->halves, b->values, b->len);
+}
+static void run_float_from_bfloat16(void *p) {
+    Float16Bench *b = p;
+    BitConverter_FloatFromBFloat16Array(b->values, b->halves, b->len);
+}
+
+static void bench_float16(BenchConfig *cfg, size_t n) {
+    Float16Bench b = { bench_alloc(n * sizeof(float)), bench_alloc(n * sizeof(uint16_t)), n };
+    fill_float(b.values, n, false);
+    const BenchCase cases[] = {
+        { "BitConverter_HalfFromFloatArray", "float", n, sizeof(float), NULL, run_half_from_float, &b },
+        { "BitConverter_FloatFromHalfArray", "float", n, sizeof(float), NULL, run_float_from_half, &b },
+        { "BitConverter_BFloat16FromFloatArray", "float", n, sizeof(float), NULL, run_bfloat16_from_float, &b },
+        { "BitConverter_FloatFromBFloat16Array", "float", n, sizeof(float), NULL, run_float_from_bfloat16, &b },
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        bench_run(cfg, &cases[i]);
+    }
+    free(b.values);
+    free(b.halves);
+}
+
+/*!
+ * \brief Benchmarks for the bit operations: buffer popcount and per-value pext.
+ */
+typedef struct {
+    uint64_t *words;
+    uint64_t *out;
+    size_t len;
+    size_t sink;
+} BitOpsBench;
+
+static void run_popcount_array(void *p) {
+    BitOpsBench *b = p;
+    b->sink += bitops_popcountArray(b->words, b->len * sizeof(uint64_t));
+}
+static void run_extract(void *p) {
+    BitOpsBench *b = p;
+    for (size_t i = 0; i < b->len; ++i) {
+        b->out[i] = bitops_extract_uint64_t(b->words[i], UINT64_C(0x00FF00FF0F0F3333));
+    }
+}
+
+static void bench_bitops(BenchConfig *cfg, size_t n) {
+    BitOpsBench b = { bench_alloc(n * sizeof(uint64_t)), bench_alloc(n * sizeof(uint64_t)), n, 0 };
+    fill_uint64_t(b.words, n, false);
+    const BenchCase pop = { "bitops_popcountArray", "uint64_t", n, sizeof(uint64_t), NULL, run_popcount_array, &b };
+    const BenchCase ext = { "bitops_extract", "uint64_t", n, sizeof(uint64_t), NULL, run_extract, &b };
+    bench_run(cfg, &pop);
+    bench_run(cfg, &ext);
+    free(b.words);
+    free(b.out);
+}
+
+/*!
+ * \brief Benchmarks for the hex and Base64 codecs over 8 * n random bytes.
+ */
+typedef struct {
+    uint8_t *bytes;
+    char *text;
+    size_t len;
+} TextCodecBench;
+
+static void run_hex_encode(void *p) {
+    TextCodecBench *b = p;
+    hex_encode(b->bytes, b->len, b->text, hex_encodedSize(b->len), false, NULL);
+}
+static void run_hex_decode(void *p) {
+    TextCodecBench *b = p;
+    hex_decode(b->text, hex_encodedSize(b->len), b->bytes, b->len, NULL);
+}
+static void run_base64_encode(void *p) {
+    TextCodecBench *b = p;
+    base64_encode(b->bytes, b->len, BASE64_STANDARD, b->text, base64_encodedSize(b->len, BASE64_STANDARD), NULL);
+}
+static void run_base64_decode(void *p) {
+    TextCodecBench *b = p;
+    base64_decode(b->text, base64_encodedSize(b->len, BASE64_STANDARD), BASE64_STANDARD, b->bytes, b->len, NULL);
+}
+
+static void bench_textcodec(BenchConfig *cfg, size_t n) {
+    const size_t len = n * sizeof(uint64_t);
+    TextCodecBench b = { bench_alloc(len), bench_alloc(hex_encodedSize(len)), len };
+    fill_uint64_t((uint64_t *)b.bytes, n, false);
+    const BenchCase hexEncode = { "hex_encode", "uint8_t", len, 1, NULL, run_hex_encode, &b };
+    const BenchCase hexDecode = { "hex_decode", "uint8_t", len, 1, NULL, run_hex_decode, &b };
+    const BenchCase base64Encode = { "base64_encode", "uint8_t", len, 1, NULL, run_base64_encode, &b };
+    const BenchCase base64Decode = { "base64_decode", "uint8_t", len, 1, NULL, run_base64_decode, &b };
+    run_hex_encode(&b);
+    bench_run(cfg, &hexEncode);
+    bench_run(cfg, &hexDecode);
+    run_base64_encode(&b);
+    bench_run(cfg, &base64Encode);
+    bench_run(cfg, &base64Decode);
+    free(b.bytes);
+    free(b.text);
+}
+
+/*!
+ * \brief Benchmarks for CRC32C and XXH64 over 8 * n random bytes.
+ */
+typedef struct {
+    uint8_t *bytes;
+    size_t len;
+    uint64_t sink;
+} HashBench;
+
+static void run_crc32c(void *p) {
+    HashBench *b = p;
+    b->sink += crc32c(0, b->bytes, b->len);
+}
+static void run_hash64(void *p) {
+    HashBench *b = p;
+    b->sink += hash64(b->bytes, b->len, 0);
+}
+
+static void bench_hash(BenchConfig *cfg, size_t n) {
+    HashBench b = { bench_alloc(n * sizeof(uint64_t)), n * sizeof(uint64_t), 0 };
+    fill_uint64_t((uint64_t *)b.bytes, n, false);
+    const BenchCase crc = { "crc32c", "uint8_t", b.len, 1, NULL, run_crc32c, &b };
+    const BenchCase xxh = { "hash64", "uint8_t", b.len, 1, NULL, run_hash64, &b };
+    bench_run(cfg, &crc);
+    bench_run(cfg, &xxh);
+    free(b.bytes);
+}
+
+/*!
+ * \brief Benchmarks for quaternion arithmetic over arrays of n quaternions.
+ */
+#define BENCH_QUAT_DEFINE(suf, T) \
+typedef struct { \
+    Quaternion##suf *a; \
+    Quaternion##suf *b; \
+    Quaternion##suf *out; \
+    size_t len; \
+} QuatBench##suf; \
+\
+static T quat_rand_##suf(void) { \
+    return (T)((double)(bench_rand() >> 11) * 0x1.0p-53 + 0.5); \
+} \
+static void run_quat##suf##_mult(void *p) { \
+    QuatBench##suf *q = p; \
+    for (size_t i = 0; i < q->len; ++i) { \
+        q->out[i] = quat##suf##_mult(&q->a[i], &q->b[i]); \
+    } \
+} \
+static void run_quat##suf##_add(void *p) { \
+    QuatBench##suf *q = p; \
+    for (size_t i = 0; i < q->len; ++i) { \
+        q->out[i] = quat##suf##_add(&q->a[i], &q->b[i]); \
+    } \
+} \
+static void run_quat##suf##_inv(void *p) { \
+    QuatBench##suf *q = p; \
+    for (size_t i = 0; i < q->len; ++i) { \
+        q->out[i] = quat##suf##_inv(&q->a[i]); \
+    } \
+} \
+\
+static void bench_quat##suf(BenchConfig *cfg, size_t n) { \
+    QuatBench##suf q = { \
+        bench_alloc(n * sizeof(Quaternion##suf)), \
+        bench_alloc(n * sizeof(Quaternion##suf)), \
+        bench_alloc(n * sizeof(Quaternion##suf)), \
+        n \
+    }; \
+    for (size_t i = 0; i < n; ++i) { \
+        q.a[i] = (Quaternion##suf){ quat_rand_##suf(), quat_rand_##suf(), quat_rand_##suf(), quat_rand_##suf() }; \
+        q.b[i] = (Quaternion##suf){ quat_rand_##suf(), quat_rand_##suf(), quat_rand_##suf(), quat_rand_##suf() }; \
+    } \
+    const BenchCase cases[] = { \
+        { "quat_mult", #T, n, sizeof(Quaternion##suf), NULL, run_quat##suf##_mult, &q }, \
+        { "quat_add", #T, n, sizeof(Quaternion##suf), NULL, run_quat##suf##_add, &q }, \
+        { "quat_inv", #T, n, sizeof(Quaternion##suf), NULL, run_quat##suf##_inv, &q }, \
+    }; \
+    for (size_t i = 0; i < sizeof cases / sizeof cases[0]; ++i) { \
+        bench_run(cfg, &cases[i]); \
+    } \
+    free(q.a); \
+    free(q.b); \
+    free(q.out); \
+}
+
+    FLOAT_TYPE_MAP(BENCH_QUAT_DEFINE)
+
+#undef BENCH_QUAT_DEFINE
+
+typedef struct {
+    MemoryPool pool;
+    void *buf;
+    void **blocks;
+    size_t len;
+} PoolBench;
+
+static void run_pool_init(void *p) {
+    PoolBench *b = p;
+    mp_init(&b->pool, b->buf, b->len * BENCH_POOL_BLOCK, BENCH_POOL_BLOCK, b->len, NULL);
+}
+
+static void run_pool(void *p) {
+    PoolBench *b = p;
+    for (size_t i = 0; i < b->len; ++i) {
+        b->blocks[i] = mp_alloc(&b->pool);
+    }
+    for (size_t i = 0; i < b->len; ++i) {
+        mp_free(&b->pool, b->blocks[i]);
+    }
+}
+
+static void bench_pool(BenchConfig *cfg, size_t n) {
+    PoolBench b = { .buf = bench_alloc(n * BENCH_POOL_BLOCK), .blocks = bench_alloc(n * sizeof(void *)), .len = n };
+    if (mp_init(&b.pool, b.buf, n * BENCH_POOL_BLOCK, BENCH_POOL_BLOCK, n, NULL)) {
+        const BenchCase init = { "MemoryPool_Init", "block64", n, BENCH_POOL_BLOCK, NULL, run_pool_init, &b };
+        const BenchCase c = { "MemoryPool_AllocFree", "block64", n, BENCH_POOL_BLOCK, NULL, run_pool, &b };
+        bench_run(cfg, &init);
+        bench_run(cfg, &c);
+    }
+    free(b.blocks);
+    free(b.buf);
+}
+
+#define BENCH_SLAB_SLOTS 4096 //!< objects kept live by the mixed-size allocation benchmark
+
+/*!
+ * \brief Mixed-size churn: each step frees a random live object and allocates one of a random size
+ * in its place (mostly up to 1 KiB, one in sixteen up to 16 KiB), touching its first byte.
+ */
+typedef struct {
+    SlabAllocator slab;
+    void *live[BENCH_SLAB_SLOTS];
+    uint16_t *slots; //!< slot replaced at each step
+    uint32_t *sizes; //!< size allocated at each step
+    size_t len;
+    bool useSlab;
+} SlabBench;
+
+static void run_slab(void *p) {
+    SlabBench *b = p;
+    for (size_t i = 0; i < b->len; ++i) {
+        void **slot = &b->live[b->slots[i]];
+        unsigned char *block;
+        if (b->useSlab) {
+            slab_free(&b->slab, *slot);
+            block = slab_alloc(&b->slab, b->sizes[i]);
+        } else {
+            free(*slot);
+            block = malloc(b->sizes[i]);
+        }
+        if (block) {
+            block[0] = (unsigned char)i;
+        }
+        *slot = block;
+    }
+}
+
+static void bench_slab(BenchConfig *cfg, size_t n) {
+    SlabBench *b = bench_alloc(sizeof *b);
+    b->slots = bench_alloc(n * sizeof b->slots[0]);
+    b->sizes = bench_alloc(n * sizeof b->sizes[0]);
+    b->len = n;
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t r = bench_rand();
+        b->slots[i] = (uint16_t)(r % BENCH_SLAB_SLOTS);
+        b->sizes[i] = (uint32_t)((r >> 16) % 16 == 0 ? (r >> 20) % SLAB_MAX_SMALL + 1 : (r >> 20) % 1024 + 1);
+    }
+    if (slab_init(&b->slab)) {
+        const BenchCase slab = { "SlabAllocator_Mixed", "mixed", n, 0, NULL, run_slab, b };
+        const BenchCase libc = { "malloc_Mixed", "mixed", n, 0, NULL, run_slab, b };
+        memset(b->live, 0, sizeof b->live);
+        b->useSlab = true;
+        bench_run(cfg, &slab);
+        slab_destroy(&b->slab);
+        memset(b->live, 0, sizeof b->live);
+        b->useSlab = false;
+        bench_run(cfg, &libc);
+        for (size_t i = 0; i < BENCH_SLAB_SLOTS; ++i) {
+            free(b->live[i]);
+        }
+    }
+    free(b->slots);
+    free(b->sizes);
+    free(b);
+}
+
+#ifndef __STDC_NO_THREADS__
+#define BENCH_POOL_MAX_THREADS 64 //!< upper bound on --threads for the shared pool benchmark
+#define BENCH_POOL_BATCH 8 //!< blocks each thread holds at once in the shared pool benchmark
+
+/*!
+ * \brief Shared-pool churn: every thread repeatedly takes a batch of blocks, stamps them with its id,
+ * checks the stamps and returns them. Doubles as a smoke test; a block handed to two threads at
+ * once usually shows up as a mismatch at either end and is reported on stderr. Only the ends are
+ * compared so the check stays cheap next to the allocator; test_atomic_pool checks whole blocks.
+ * The threads are started once and parked between repetitions, so creating and joining them is
+ * not timed.
+ */
+typedef enum {
+    SHARED_POOL_ATOMIC, //!< every call goes to the AtomicMemoryPool
+    SHARED_POOL_MUTEX, //!< MemoryPool behind a mutex
+    SHARED_POOL_MAGAZINE //!< per-thread MagazineCache in front of an AtomicMemoryPool
+} SharedPoolMode;
+
+typedef struct {
+    AtomicMemoryPool atomicPool;
+    MemoryPool lockedPool;
+    mtx_t lock;
+    AtomicMemoryPool magazinePool;
+    MagazineDepot depot;
+    SharedPoolMode mode;
+    size_t rounds; //!< batches per thread
+    unsigned threads;
+    atomic_size_t corrupt;
+    mtx_t gate; //!< guards generation, pending and quit
+    cnd_t start; //!< signalled when generation advances or quit is set
+    cnd_t done; //!< signalled when pending reaches zero
+    unsigned long generation; //!< repetitions started so far
+    unsigned pending; //!< parked threads still churning in the current repetition
+    bool quit;
+} SharedPoolBench;
+
+typedef struct {
+    SharedPoolBench *b;
+    unsigned char id;
+    thrd_t thread;
+    bool started; //!< false if the thread could not be created; the caller churns for it instead
+} SharedPoolWorker;
+
+static void *shared_pool_alloc(SharedPoolBench *b, MagazineCache *cache) {
+    if (b->mode == SHARED_POOL_MAGAZINE) {
+        return mc_alloc(cache);
+    }
+    if (b->mode == SHARED_POOL_ATOMIC) {
+        return amp_alloc(&b->atomicPool);
+    }
+    mtx_lock(&b->lock);
+    void *block = mp_alloc(&b->lockedPool);
+    mtx_unlock(&b->lock);
+    return block;
+}
+
+static void shared_pool_free(SharedPoolBench *b, MagazineCache *cache, void *block) {
+    if (b->mode == SHARED_POOL_MAGAZINE) {
+        mc_free(cache, block);
+        return;
+    }
+    if (b->mode == SHARED_POOL_ATOMIC) {
+        amp_free(&b->atomicPool, block);
+        return;
+    }
+    mtx_lock(&b->lock);
+    mp_free(&b->lockedPool, block);
+    mtx_unlock(&b->lock);
+}
+
+static void shared_pool_churn(SharedPoolWorker *w) {
+    SharedPoolBench *b = w->b;
+    unsigned char *held[BENCH_POOL_BATCH];
+    MagazineCache cache;
+    if (b->mode == SHARED_POOL_MAGAZINE) {
+        mc_init(&cache, &b->depot);
+    }
+    for (size_t r = 0; r < b->rounds; ++r) {
+        size_t count = 0;
+        while (count < BENCH_POOL_BATCH && (held[count] = shared_pool_alloc(b, &cache)) != NULL) {
+            memset(held[count++], w->id, BENCH_POOL_BLOCK);
+        }
+        while (count > 0) {
+            unsigned char *block = held[--count];
+            if (block[0] != w->id || block[BENCH_POOL_BLOCK - 1] != w->id) {
+                atomic_fetch_add_explicit(&b->corrupt, 1, memory_order_relaxed);
+            }
+            shared_pool_free(b, &cache, block);
+        }
+    }
+    if (b->mode == SHARED_POOL_MAGAZINE) {
+        mc_drain(&cache);
+    }
+}
+
+/*! \brief Parks until a repetition starts, churns once, reports back; until quit is set. */
+static int shared_pool_thread(void *arg) {
+    SharedPoolWorker *w = arg;
+    SharedPoolBench *b = w->b;
+    unsigned long seen = 0;
+    for (;;) {
+        mtx_lock(&b->gate);
+        while (b->generation == seen && !b->quit) {
+            cnd_wait(&b->start, &b->gate);
+        }
+        seen = b->generation;
+        const bool quit = b->quit;
+        mtx_unlock(&b->gate);
+        if (quit) {
+            return 0;
+        }
+        shared_pool_churn(w);
+        mtx_lock(&b->gate);
+        if (--b->pending == 0) {
+            cnd_signal(&b->done);
+        }
+        mtx_unlock(&b->gate);
+    }
+}
+
+static void run_shared_pool(void *p) {
+    SharedPoolWorker *workers = p;
+    SharedPoolBench *b = workers[0].b;
+    unsigned parked = 0;
+    for (unsigned t = 0; t < b->threads; ++t) {
+        parked += workers[t].started;
+    }
+    mtx_lock(&b->gate);
+    b->pending = parked;
+    ++b->generation;
+    cnd_broadcast(&b->start);
+    mtx_unlock(&b->gate);
+    for (unsigned t = 0; t < b->threads; ++t) {
+        if (!workers[t].started) {
+            shared_pool_churn(&workers[t]);
+        }
+    }
+    mtx_lock(&b->gate);
+    while (b->pending > 0) {
+        cnd_wait(&b->done, &b->gate);
+    }
+    mtx_unlock(&b->gate);
+}
+
+static void bench_shared_pool(BenchConfig *cfg, size_t n) {
+    const unsigned threads = cfg->threads == 0 ? 1 : cfg->threads > BENCH_POOL_MAX_THREADS ? BENCH_POOL_MAX_THREADS : cfg->threads;
+    // fewer blocks than threads * batch, so threads also contend for running out
+    const size_t blocks = (size_t)threads * BENCH_POOL_BATCH / 2 + 1;
+    void *atomicBuf = bench_alloc(blocks * BENCH_POOL_BLOCK);
+    void *lockedBuf = bench_alloc(blocks * BENCH_POOL_BLOCK);
+    // the same shortfall, on top of the two magazines each thread may keep to itself
+    const size_t magazineBlocks = blocks + (size_t)threads * 2 * MAGAZINE_CAPACITY;
+    void *magazineBuf = bench_alloc(magazineBlocks * BENCH_POOL_BLOCK);
+    Magazine *magazines = bench_alloc((size_t)threads * 3 * sizeof(Magazine));
+    SharedPoolBench b = { .rounds = n / BENCH_POOL_BATCH + 1, .threads = threads };
+    SharedPoolWorker workers[BENCH_POOL_MAX_THREADS];
+    atomic_init(&b.corrupt, 0);
+    if (mtx_init(&b.lock, mtx_plain) == thrd_success &&
+        mtx_init(&b.gate, mtx_plain) == thrd_success &&
+        cnd_init(&b.start) == thrd_success &&
+        cnd_init(&b.done) == thrd_success &&
+        amp_init(&b.atomicPool, atomicBuf, blocks * BENCH_POOL_BLOCK, BENCH_POOL_BLOCK, blocks, NULL) &&
+        mp_init(&b.lockedPool, lockedBuf, blocks * BENCH_POOL_BLOCK, BENCH_POOL_BLOCK, blocks, NULL) &&
+        amp_init(&b.magazinePool, magazineBuf, magazineBlocks * BENCH_POOL_BLOCK, BENCH_POOL_BLOCK, magazineBlocks, NULL) &&
+        md_init(&b.depot, &b.magazinePool, magazines, (size_t)threads * 3)) {
+        for (unsigned t = 0; t < threads; ++t) {
+            workers[t] = (SharedPoolWorker){ .b = &b, .id = (unsigned char)(t + 1) };
+            workers[t].started = thrd_create(&workers[t].thread, shared_pool_thread, &workers[t]) == thrd_success;
+        }
+        const size_t ops = b.rounds * BENCH_POOL_BATCH * threads;
+        const BenchCase lockFree = { "AtomicMemoryPool_Shared", "block64", ops, BENCH_POOL_BLOCK, NULL, run_shared_pool, workers };
+        const BenchCase locked = { "MemoryPool_Mutex_Shared", "block64", ops, BENCH_POOL_BLOCK, NULL, run_shared_pool, workers };
+        const BenchCase cached = { "MagazineCache_Shared", "block64", ops, BENCH_POOL_BLOCK, NULL, run_shared_pool, workers };
+        b.mode = SHARED_POOL_ATOMIC;
+        bench_run(cfg, &lockFree);
+        b.mode = SHARED_POOL_MUTEX;
+        bench_run(cfg, &locked);
+        b.mode = SHARED_POOL_MAGAZINE;
+        bench_run(cfg, &cached);
+
+        mtx_lock(&b.gate);
+        b.quit = true;
+        cnd_broadcast(&b.start);
+        mtx_unlock(&b.gate);
+        for (unsigned t = 0; t < threads; ++t) {
+            if (workers[t].started) {
+                thrd_join(workers[t].thread, NULL);
+            }
+        }
+        cnd_destroy(&b.done);
+        cnd_destroy(&b.start);
+        mtx_destroy(&b.gate);
+        mtx_destroy(&b.lock);
+    }
+    if (atomic_load(&b.corrupt) != 0) {
+        fprintf(stderr, "cmor_bench: shared pool handed one block to two threads (%zu times)\n", (size_t)atomic_load(&b.corrupt));
+        cfg->failed = true;
+    }
+    free(atomicBuf);
+    free(lockedBuf);
+    free(magazineBuf);
+    free(magazines);
+}
+#endif // __STDC_NO_THREADS__
+
+#define BENCH_RECORD_BYTES 14 //!< uint32 id, int16 tag, double value
+
+typedef struct {
+    uint8_t *buf;
+    uint32_t *ids;
+    int16_t *tags;
+    double *values;
+    size_t len;
+} RecordBench;
+
+static void run_record_write(void *p) {
+    RecordBench *b = p;
+    BinaryWriter w;
+    bw_init(&w, b->buf, b->len * BENCH_RECORD_BYTES, BINARY_BIG_ENDIAN);
+    for (size_t i = 0; i < b->len && bw_ensure(&w, BENCH_RECORD_BYTES); ++i) {
+        bw_writeUInt32Unchecked(&w, b->ids[i]);
+        bw_writeInt16Unchecked(&w, b->tags[i]);
+        bw_writeDoubleUnchecked(&w, b->values[i]);
+    }
+}
+
+static void run_record_read(void *p) {
+    RecordBench *b = p;
+    BinaryReader r;
+    br_init(&r, b->buf, b->len * BENCH_RECORD_BYTES, BINARY_BIG_ENDIAN);
+    for (size_t i = 0; i < b->len && br_ensure(&r, BENCH_RECORD_BYTES); ++i) {
+        b->ids[i] = br_readUInt32Unchecked(&r);
+        b->tags[i] = br_readInt16Unchecked(&r);
+        b->values[i] = br_readDoubleUnchecked(&r);
+    }
+}
+
+static void run_array_read(void *p) {
+    RecordBench *b = p;
+    BinaryReader r;
+    br_init(&r, b->buf, b->len * sizeof(double), BINARY_BIG_ENDIAN);
+    br_readArrayDouble(&r, b->values, b->len);
+}
+
+static void bench_binaryio(BenchConfig *cfg, size_t n) {
+    RecordBench b = {
+        bench_alloc(n * BENCH_RECORD_BYTES),
+        bench_alloc(n * sizeof(uint32_t)),
+        bench_alloc(n * sizeof(int16_t)),
+        bench_alloc(n * sizeof(double)),
+        n
+    };
+    fill_uint32_t(b.ids, n, false);
+    fill_int16_t(b.tags, n, false);
+    fill_double(b.values, n, false);
+    const BenchCase cases[] = {
+        { "BinaryWriter_Record", "record14", n, BENCH_RECORD_BYTES, NULL, run_record_write, &b },
+        { "BinaryReader_Record", "record14", n, BENCH_RECORD_BYTES, NULL, run_record_read, &b },
+        { "BinaryReader_ReadArray", "double", n, sizeof(double), NULL, run_array_read, &b },
+    };
+    for (size_t i = 0; i < sizeof cases / sizeof cases[0]; ++i) {
+        bench_run(cfg, &cases[i]);
+    }
+    free(b.buf);
+    free(b.ids);
+    free(b.tags);
+    free(b.values);
+}
+
+/*!
+ * \brief Benchmarks for a mapped file of n big-endian doubles: per-element getters and bulk copies.
+ * \remarks The file is written to $TMPDIR (or /tmp) and stays in the page cache, so this
+ * measures the decode cost rather than the disk.
+ */
+typedef struct {
+    MappedView view;
+    double *values;
+    double sink;
+} MappedBench;
+
+static void run_mapped_get(void *p) {
+    MappedBench *b = p;
+    double sum = 0.0;
+    for (size_t i = 0; i < b->view.count; ++i) {
+        sum += mv_getDouble(&b->view, i);
+    }
+    b->sink += sum;
+}
+static void run_mapped_copy(void *p) {
+    MappedBench *b = p;
+    mv_copyDouble(&b->view, 0, b->view.count, b->values);
+}
+
+static void bench_mappedfile(BenchConfig *cfg, size_t n) {
+    const char *dir = getenv("TMPDIR");
+    char path[4096];
+    if (snprintf(path, sizeof path, "%s/cmor_bench_XXXXXX", dir && *dir ? dir : "/tmp") >= (int)sizeof path) {
+        return;
+    }
+    const int fd = mkstemp(path);
+    if (fd < 0) {
+        return;
+    }
+    MappedBench b = { .values = bench_alloc(n * sizeof(double)) };
+    BinaryWriter w;
+    uint8_t *bytes = bench_alloc(n * sizeof(double));
+    fill_double(b.values, n, false);
+    bw_init(&w, bytes, n * sizeof(double), BINARY_BIG_ENDIAN);
+    bw_writeArrayDouble(&w, b.values, n);
+    const bool written = write(fd, bytes, n * sizeof(double)) == (ssize_t)(n * sizeof(double));
+    close(fd);
+    if (written && mv_open(&b.view, path, 0, sizeof(double), BINARY_BIG_ENDIAN) == MAPPED_SUCCESS) {
+        const BenchCase get = { "MappedView_Get", "double", n, sizeof(double), NULL, run_mapped_get, &b };
+        const BenchCase copy = { "MappedView_Copy", "double", n, sizeof(double), NULL, run_mapped_copy, &b };
+        mv_advise(&b.view, 0, n, MAPPED_ADVICE_SEQUENTIAL);
+        bench_run(cfg, &get);
+        bench_run(cfg, &copy);
+        mv_close(&b.view);
+    }
+    unlink(path);
+    free(bytes);
+    free(b.values);
+}
+
+/*!
+ * \brief Benchmarks for the varint codecs, on values of 1 to 28 bits (mostly 2 to 4 byte encodings).
+ */
+#define BENCH_VARINT_DEFINE(NAME, T) \
+typedef struct { \
+    T *values; \
+    uint8_t *bytes; \
+    size_t encoded; \
+    size_t len; \
+} VarintBench_##T; \
+\
+static void run_varint_encode_##T(void *p) { \
+    VarintBench_##T *b = p; \
+    varint_encodeArray##NAME(b->values, b->len, b->bytes, b->len * VARINT_MAX_BYTES_64, &b->encoded); \
+} \
+static void run_varint_decode_##T(void *p) { \
+    VarintBench_##T *b = p; \
+    size_t consumed; \
+    varint_decodeArray##NAME(b->bytes, b->encoded, b->values, b->len, &consumed); \
+} \
+\
+static void bench_varint_##T(BenchConfig *cfg, size_t n) { \
+    VarintBench_##T b = { bench_alloc(n * sizeof(T)), bench_alloc(n * VARINT_MAX_BYTES_64), 0, n }; \
+    for (size_t i = 0; i < n; ++i) { \
+        uint64_t r = bench_rand(); \
+        b.values[i] = (T)((r >> 8) & ((UINT64_C(1) << (1 + (r & 0xFF) % 28)) - 1)); \
+    } \
+    run_varint_encode_##T(&b); \
+    const BenchCase enc = { "varint_encodeArray", #T, n, sizeof(T), NULL, run_varint_encode_##T, &b }; \
+    const BenchCase dec = { "varint_decodeArray", #T, n, sizeof(T), NULL, run_varint_decode_##T, &b }; \
+    bench_run(cfg, &enc); \
+    bench_run(cfg, &dec); \
+    free(b.values); \
+    free(b.bytes); \
+}
+
+    VARINT_TYPE_MAP(BENCH_VARINT_DEFINE)
+
+#undef BENCH_VARINT_DEFINE
+
+/*!
+ * \brief Benchmarks for the bit-packing codecs, on a slowly rising series with noise in the low bits
+ * (the sensor-log shape both frame of reference and delta are aimed at).
+ */
+#define BENCH_BITPACK_DEFINE(suf, T) \
+typedef struct { \
+    T *values; \
+    uint8_t *bytes; \
+    size_t encoded; \
+    size_t len; \
+    BitpackMode mode; \
+} BitpackBench_##T; \
+\
+static void run_bitpack_encode_##T(void *p) { \
+    BitpackBench_##T *b = p; \
+    bitpack_encode_##T(b->values, b->len, b->mode, b->bytes, bitpack_max_size(b->len, sizeof(T)), &b->encoded); \
+} \
+static void run_bitpack_decode_##T(void *p) { \
+    BitpackBench_##T *b = p; \
+    size_t consumed; \
+    bitpack_decode_##T(b->bytes, b->encoded, b->mode, b->values, b->len, &consumed); \
+} \
+\
+static void bench_bitpack_##T(BenchConfig *cfg, size_t n) { \
+    BitpackBench_##T b = { bench_alloc(n * sizeof(T)), bench_alloc(bitpack_max_size(n, sizeof(T))), 0, n, BITPACK_FOR }; \
+    for (size_t i = 0; i < n; ++i) { \
+        b.values[i] = (T)(i / 4 + (bench_rand() & 7)); \
+    } \
+    run_bitpack_encode_##T(&b); \
+    const BenchCase enc = { "bitpack_encode_for", #T, n, sizeof(T), NULL, run_bitpack_encode_##T, &b }; \
+    const BenchCase dec = { "bitpack_decode_for", #T, n, sizeof(T), NULL, run_bitpack_decode_##T, &b }; \
+    bench_run(cfg, &enc); \
+    bench_run(cfg, &dec); \
+    b.mode = BITPACK_DELTA; \
+    run_bitpack_encode_##T(&b); \
+    const BenchCase delta = { "bitpack_decode_delta", #T, n, sizeof(T), NULL, run_bitpack_decode_##T, &b }; \
+    bench_run(cfg, &delta); \
+    free(b.values); \
+    free(b.bytes); \
+}
+
+    STDINT_TYPE_MAP(BENCH_BITPACK_DEFINE)
+
+#undef BENCH_BITPACK_DEFINE
+
+static bool parse_sizes(BenchConfig *cfg, const char *arg) {
+    cfg->sizeCount = 0;
+    while (*arg && cfg->sizeCount < BENCH_MAX_SIZES) {
+        char *end;
+        unsigned long long v = strtoull(arg, &end, 10);
+        if (end == arg || v == 0) {
+            return false;
+        }
+        cfg->sizes[cfg->sizeCount++] = (size_t)v;
+        arg = (*end == ',') ? end + 1 : end;
+        if (*end && *end != ',') {
+            return false;
+        }
+    }
+    return cfg->sizeCount > 0;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [--min-time-ms N] [--sizes N,N,...] [--threads N] [--filter SUBSTRING]\n", prog);
+}
+
+int main(int argc, char *argv[]) {
+    BenchConfig cfg = {
+        .minTimeNs = 100e6,
+        .sizes = { 16, 256, 4096, 65536, 1048576 },
+        .sizeCount = 5,
+        .threads = 4,
+        .filter = NULL,
+        .first = true,
+    };
+
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (!strcmp(argv[i], "--min-time-ms") && hasValue) {
+            cfg.minTimeNs = strtod(argv[++i], NULL) * 1e6;
+        } else if (!strcmp(argv[i], "--sizes") && hasValue) {
+            if (!parse_sizes(&cfg, argv[++i])) {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        } else if (!strcmp(argv[i], "--threads") && hasValue) {
+            cfg.threads = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (!strcmp(argv[i], "--filter") && hasValue) {
+            cfg.filter = argv[++i];
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    BitConverter_Init();
+
+    printf("{\n  \"library\": \"cmor\",\n  \"compiler\": \"%s\",\n  \"build_type\": \"%s\",\n"
+           "  \"timestamp\": %lld,\n  \"min_time_ms\": %.1f,\n  \"threads\": %u,\n  \"results\": [",
+#ifdef __VERSION__
+           __VERSION__,
+#else
+           "unknown",
+#endif
+           CMOR_BENCH_BUILD_TYPE, (long long)time(NULL), cfg.minTimeNs / 1e6, cfg.threads);
+
+    for (size_t s = 0; s < cfg.sizeCount; ++s) {
+        size_t n = cfg.sizes[s];
+#define BENCH_CALL(T) bench_array_##T(&cfg, n);
+        TYPE_ITERATOR(BENCH_CALL)
+#undef BENCH_CALL
+#define BENCH_CALL(SUF, T) bench_bitconv_##T(&cfg, n);
+        BITCONV_TYPE_MAP(BENCH_CALL)
+#undef BENCH_CALL
+        bench_float16(&cfg, n);
+        bench_bitops(&cfg, n);
+        bench_textcodec(&cfg, n);
+        bench_hash(&cfg, n);
+#define BENCH_CALL(T) bench_container_##T(&cfg, n);
+        TYPE_ITERATOR(BENCH_CALL)
+#undef BENCH_CALL
+#define BENCH_CALL(suf, T) bench_quat##suf(&cfg, n);
+        FLOAT_TYPE_MAP(BENCH_CALL)
+#undef BENCH_CALL
+        bench_binaryio(&cfg, n);
+        bench_mappedfile(&cfg, n);
+#define BENCH_CALL(NAME, T) bench_varint_##T(&cfg, n);
+        VARINT_TYPE_MAP(BENCH_CALL)
+#undef BENCH_CALL
+#define BENCH_CALL(suf, T) bench_bitpack_##T(&cfg, n);
+        STDINT_TYPE_MAP(BENCH_CALL)
+#undef BENCH_CALL
+        bench_pool(&cfg, n);
+        bench_slab(&cfg, n);
+#ifndef __STDC_NO_THREADS__
+        bench_shared_pool(&cfg, n);
+#endif
+    }
+
+    printf("\n  ]\n}\n");
+    return cfg.failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
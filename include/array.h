@@ -42,6 +42,10 @@ extern "C" {
 
 /*!
  * \brief Generic macro to compute the average of an array.
+ * \remarks Sums with SIMD kernels chosen at runtime (AVX2 or AVX-512 when the CPU has them)
+ * using several independent accumulators. Integer types accumulate exactly in widened
+ * integers and floats accumulate in double, so only the final division rounds.
+ * \see Array_AvgCompensated for error-compensated floating-point summation.
  * 
  * \version 0.1
  * \author William (116991920+wdg0008@users.noreply.github.com)
@@ -52,6 +56,27 @@ extern "C" {
     TYPE_PTR_TABLE(Array_Avg) \
 )(arr, length))
 
+#define GM_AVG_COMPENSATED_DECLARE(T) double Array_AvgCompensated_##T(const T* arr, size_t length);
+
+    TYPE_ITERATOR(GM_AVG_COMPENSATED_DECLARE) // Declare compensated average functions
+
+#undef GM_AVG_COMPENSATED_DECLARE
+
+/*!
+ * \brief Generic macro to compute the average of an array with compensated summation.
+ * \remarks Floats and doubles use vectorized Neumaier (improved Kahan) summation, which keeps
+ * the error independent of the array length at roughly twice the cost of \ref Array_Avg.
+ * Integer types are already exact and behave exactly like \ref Array_Avg.
+ * 
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define Array_AvgCompensated(arr, length) (_Generic((arr), \
+    TYPE_PTR_TABLE(Array_AvgCompensated) \
+)(arr, length))
+
 #define GM_SWAP_DECLARE(T) void swap_##T(T* a, T* b);
 
     TYPE_ITERATOR(GM_SWAP_DECLARE) // Declare swap functions
@@ -110,6 +135,120 @@ extern "C" {
     TYPE_PTR_TABLE(partition) \
 )(data, leftend, rightend)
 
+#define ARRAY_SORT_DECLARE(T) void Array_Sort_##T(T data[], size_t len);
+
+    TYPE_ITERATOR(ARRAY_SORT_DECLARE) // Declare introsort functions
+
+#undef ARRAY_SORT_DECLARE
+
+/*!
+ * \brief Generic macro to sort an entire array in ascending order.
+ * \remarks Non-recursive introsort: quicksort with a median-of-3 (ninther for large ranges) pivot,
+ * heapsort once the partition depth exceeds 2*log2(len), and insertion sort for short ranges.
+ * Runs in O(n log n) worst case with O(log n) bounded stack use and no allocation.
+ * \warning The sort is not stable. Arrays containing NaN are not sorted meaningfully.
+ *
+ * \param data Array to sort in place.
+ * \param len Number of elements in the array.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define Array_Sort(data, len) _Generic((data), \
+    TYPE_PTR_TABLE(Array_Sort) \
+)(data, len)
+
+#define SELECTION_DECLARE(T) \
+void Array_NthElement_##T(T data[], size_t len, size_t k); \
+void Array_PartialSort_##T(T data[], size_t len, size_t k); \
+double Array_Median_##T(T data[], size_t len);
+
+    TYPE_ITERATOR(SELECTION_DECLARE) // Declare selection functions
+
+#undef SELECTION_DECLARE
+
+/*!
+ * \brief Generic macro to move the k-th smallest element into position k.
+ * \remarks Afterwards nothing before index k is greater than data[k] and nothing after it is smaller.
+ * Introselect: Hoare partitioning around a median-of-3 or ninther pivot, switching to
+ * median-of-medians pivots whenever two partitions in a row fail to halve the range,
+ * so the worst case is O(n) and the typical case is a small multiple of n.
+ * A percentile is Array_NthElement(data, len, p * (len - 1)).
+ * \warning Does nothing when k >= len. Arrays containing NaN give unspecified results.
+ *
+ * \param data Array to rearrange in place.
+ * \param len Number of elements in the array.
+ * \param k Zero-based rank to select.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define Array_NthElement(data, len, k) _Generic((data), \
+    TYPE_PTR_TABLE(Array_NthElement) \
+)(data, len, k)
+
+/*!
+ * \brief Generic macro to sort only the k smallest elements into data[0..k).
+ * \remarks Selects with \ref Array_NthElement, then sorts the prefix, for O(n + k log k).
+ * The order of the remaining elements is unspecified. k >= len sorts everything.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define Array_PartialSort(data, len, k) _Generic((data), \
+    TYPE_PTR_TABLE(Array_PartialSort) \
+)(data, len, k)
+
+/*!
+ * \brief Generic macro to compute the median of an array in linear time.
+ * \remarks Even lengths return the mean of the two middle elements. Returns 0.0 for an empty array.
+ * \warning The array is reordered, as by \ref Array_NthElement.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define Array_Median(data, len) _Generic((data), \
+    TYPE_PTR_TABLE(Array_Median) \
+)(data, len)
+
+#define RADIX_SORT_DECLARE(T) void Array_RadixSort_##T(T data[], size_t len, T scratch[]);
+
+    TYPE_ITERATOR(RADIX_SORT_DECLARE) // Declare radix sort functions
+
+#undef RADIX_SORT_DECLARE
+
+/*!
+ * \brief Generic macro to sort an array with a least-significant-digit radix sort.
+ * \remarks Linear time with one byte per pass. All digit histograms are built in a single read,
+ * and passes whose digit is the same for every element are skipped entirely.
+ * Signed integers have their sign bit flipped and floats are mapped through their IEEE bits,
+ * so the order matches numeric order with -0.0 before +0.0.
+ * The sort is stable. Short arrays use an insertion sort on the same keys, and a NULL scratch the
+ * introsort of \ref SORT_WITH_CTX_DEFINE on them: O(n log n), several times slower than with
+ * scratch. Keys map one-to-one onto bit patterns, so the result is identical either way.
+ * \warning NaNs with the sign bit set sort first and all other NaNs sort last.
+ *
+ * \param data Array to sort in place.
+ * \param len Number of elements in the array.
+ * \param scratch Buffer of at least len elements of the same type.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define Array_RadixSort(data, len, scratch) _Generic((data), \
+    TYPE_PTR_TABLE(Array_RadixSort) \
+)(data, len, scratch)
+
 #define MERGE_SORT_DECLARE(T) void MergeSort_##T(T A[], int left, int right, T temp[]);
 
     TYPE_ITERATOR(MERGE_SORT_DECLARE) // Declare merge sort functions)
@@ -148,6 +287,280 @@ extern "C" {
     TYPE_PTR_TABLE(merge) \
 )(A, left, leftend, right, rightend, temp)
 
+#define NATURAL_MERGE_SORT_DECLARE(T) void Array_MergeSort_##T(T data[], size_t len, T temp[]);
+
+    TYPE_ITERATOR(NATURAL_MERGE_SORT_DECLARE) // Declare bottom-up merge sort functions
+
+#undef NATURAL_MERGE_SORT_DECLARE
+
+/*!
+ * \brief Generic macro to perform a stable, bottom-up natural merge sort on an array.
+ * \remarks Existing ascending runs are kept, strictly descending runs are reversed in place,
+ * and runs shorter than 32 elements are extended with insertion sort. Each pass then merges
+ * neighbouring runs from one buffer into the other, alternating between data and temp,
+ * so nothing is copied back between passes. Merges switch to galloping (exponential search
+ * plus block copies) when one run keeps winning, as in TimSort.
+ * Already sorted or reversed input finishes in a single linear scan.
+ * A NULL temp falls back to a plain insertion sort: still stable, but O(n^2), so only
+ * suitable for short arrays.
+ *
+ * \param data Array to sort in place.
+ * \param len Number of elements in the array.
+ * \param temp Buffer of at least len elements of the same type, or NULL (see above).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define Array_MergeSort(data, len, temp) _Generic((data), \
+    TYPE_PTR_TABLE(Array_MergeSort) \
+)(data, len, temp)
+
+#define ARGSORT_DECLARE(T) void Array_ArgSort_##T(const T keys[], size_t len, size_t indices[]);
+
+    TYPE_ITERATOR(ARGSORT_DECLARE) // Declare argsort functions
+
+#undef ARGSORT_DECLARE
+
+/*!
+ * \brief Generic macro to compute the permutation that sorts an array, without moving it.
+ * \remarks After the call, keys[indices[0]] <= keys[indices[1]] <= ... Equal keys keep their
+ * original relative order. Use it to sort parallel columns or large records by one key.
+ * \warning Arrays containing NaN are not sorted meaningfully.
+ *
+ * \param keys Array of keys to order (not modified).
+ * \param len Number of elements in keys.
+ * \param indices Output array of len indices.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define Array_ArgSort(keys, len, indices) _Generic((keys), \
+    TYPE_PTR_TABLE(Array_ArgSort) \
+)(keys, len, indices)
+
+/*! Ascending comparator for \ref SORT_BY_DEFINE */
+#define SORT_ASCENDING(a, b) ((a) < (b))
+
+/*! Descending comparator for \ref SORT_BY_DEFINE */
+#define SORT_DESCENDING(a, b) ((b) < (a))
+
+/*! Key extractor for \ref SORT_BY_DEFINE that compares whole elements */
+#define SORT_KEY_SELF(x) (x)
+
+/*! Declares a sort function generated by \ref SORT_BY_DEFINE */
+#define SORT_BY_DECLARE(NAME, T) void NAME(T data[], size_t len);
+
+/*! Ranges at or below this length are finished with insertion sort by the introsort. */
+#define INTRO_SORT_CUTOFF 16
+
+/*! Ranges above this length pick the introsort pivot with Tukey's ninther instead of median-of-3. */
+#define INTRO_SORT_NINTHER 128
+
+/*!
+ * \brief Generates an introsort over any element type with a comparator that takes a context.
+ * \remarks This is the one introsort engine: \ref Array_Sort, \ref Array_ArgSort and every
+ * \ref SORT_BY_DEFINE instantiate it. Partitions use Hoare's scheme, which stops on elements equal
+ * to the pivot so heavily duplicated input still splits evenly. The larger side is pushed onto a
+ * fixed stack and the loop continues on the smaller side, so at most log2(len) frames are live,
+ * and a range that exceeds its depth budget is handed to heapsort.
+ * All helpers are static and named after NAME, and the sort itself is NAME##_sort_(data, len, ctx).
+ * NAME##_insertion_ and NAME##_partition_ sort and split a half-open range [lo, hi) on their own. LESS(ctx, a, b) receives pointers to
+ * two elements and returns true when *a must come before *b. Because LESS is a static
+ * function in the same translation unit, the compiler can inline every comparison.
+ * Most code wants \ref SORT_BY_DEFINE instead.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define SORT_WITH_CTX_DEFINE(NAME, T, CTX_T, LESS) \
+static void NAME##_insertion_(T data[], size_t lo, size_t hi, CTX_T ctx) { \
+    for (size_t i = lo + 1; i < hi; ++i) { \
+        T value = data[i]; \
+        size_t j = i; \
+        while (j > lo && LESS(ctx, &value, &data[j - 1])) { \
+            data[j] = data[j - 1]; \
+            --j; \
+        } \
+        data[j] = value; \
+    } \
+} \
+\
+static void NAME##_sift_(T base[], size_t root, size_t n, CTX_T ctx) { \
+    T value = base[root]; \
+    size_t child; \
+    while ((child = 2 * root + 1) < n) { \
+        if (child + 1 < n && LESS(ctx, &base[child], &base[child + 1])) { \
+            ++child; \
+        } \
+        if (!LESS(ctx, &value, &base[child])) { \
+            break; \
+        } \
+        base[root] = base[child]; \
+        root = child; \
+    } \
+    base[root] = value; \
+} \
+\
+static void NAME##_heap_(T data[], size_t lo, size_t hi, CTX_T ctx) { \
+    T *base = data + lo; \
+    size_t n = hi - lo; \
+    for (size_t i = n / 2; i-- > 0;) { \
+        NAME##_sift_(base, i, n, ctx); \
+    } \
+    while (n > 1) { \
+        --n; \
+        T t = base[0]; base[0] = base[n]; base[n] = t; \
+        NAME##_sift_(base, 0, n, ctx); \
+    } \
+} \
+\
+static size_t NAME##_sort3_(T data[], size_t a, size_t b, size_t c, CTX_T ctx) { \
+    T t; \
+    if (LESS(ctx, &data[b], &data[a])) { t = data[a]; data[a] = data[b]; data[b] = t; } \
+    if (LESS(ctx, &data[c], &data[b])) { t = data[b]; data[b] = data[c]; data[c] = t; } \
+    if (LESS(ctx, &data[b], &data[a])) { t = data[a]; data[a] = data[b]; data[b] = t; } \
+    return b; \
+} \
+\
+static size_t NAME##_partition_(T data[], size_t lo, size_t hi, CTX_T ctx) { \
+    size_t n = hi - lo; \
+    size_t mid = lo + n / 2; \
+    size_t p; \
+    if (n <= INTRO_SORT_NINTHER) { \
+        p = NAME##_sort3_(data, lo, mid, hi - 1, ctx); \
+    } else { \
+        size_t step = n / 8; \
+        size_t a = NAME##_sort3_(data, lo, lo + step, lo + 2 * step, ctx); \
+        size_t b = NAME##_sort3_(data, mid - step, mid, mid + step, ctx); \
+        size_t c = NAME##_sort3_(data, hi - 1 - 2 * step, hi - 1 - step, hi - 1, ctx); \
+        p = NAME##_sort3_(data, a, b, c, ctx); \
+    } \
+    T pivot = data[p]; \
+    size_t i = lo; \
+    size_t j = hi - 1; \
+    while (1) { \
+        while (LESS(ctx, &data[i], &pivot)) ++i; \
+        while (LESS(ctx, &pivot, &data[j])) --j; \
+        if (i >= j) return j + 1; \
+        T t = data[i]; data[i] = data[j]; data[j] = t; \
+        ++i; \
+        --j; \
+    } \
+} \
+\
+static void NAME##_sort_(T data[], size_t len, CTX_T ctx) { \
+    struct { size_t lo, hi; unsigned depth; } stack[sizeof(size_t) * 8]; \
+    size_t top = 0, lo = 0, hi = len; \
+    unsigned depth = 0; \
+    for (size_t n = len; n > 1; n >>= 1) { \
+        depth += 2; \
+    } \
+    while (1) { \
+        while (hi - lo > INTRO_SORT_CUTOFF) { \
+            if (depth == 0) { \
+                NAME##_heap_(data, lo, hi, ctx); \
+                break; \
+            } \
+            --depth; \
+            size_t p = NAME##_partition_(data, lo, hi, ctx); \
+            if (p - lo < hi - p) { \
+                stack[top].lo = p; stack[top].hi = hi; stack[top].depth = depth; \
+                hi = p; \
+            } else { \
+                stack[top].lo = lo; stack[top].hi = p; stack[top].depth = depth; \
+                lo = p; \
+            } \
+            ++top; \
+        } \
+        if (hi - lo <= INTRO_SORT_CUTOFF) { \
+            NAME##_insertion_(data, lo, hi, ctx); \
+        } \
+        if (top == 0) { \
+            return; \
+        } \
+        --top; \
+        lo = stack[top].lo; \
+        hi = stack[top].hi; \
+        depth = stack[top].depth; \
+    } \
+}
+
+/*!
+ * \brief Generates `void NAME(T data[], size_t len)`, an introsort for arrays of any type.
+ * \remarks Elements are ordered by LESS(KEY(a), KEY(b)), where KEY and LESS are function-like
+ * macros expanded straight into the sort, so there is no indirect call per comparison.
+ * Instantiate it once in a source file and use \ref SORT_BY_DECLARE in a header.
+ * \code
+ * typedef struct { uint64_t timestamp; double value; } Sample;
+ * #define SAMPLE_TIME(s) ((s).timestamp)
+ * SORT_BY_DEFINE(Samples_SortByTime, Sample, SAMPLE_TIME, SORT_ASCENDING)
+ * \endcode
+ * \warning The sort is not stable. Sort an index array with \ref Array_ArgSort to avoid moving large records.
+ *
+ * \param NAME Name of the generated function.
+ * \param T Element type.
+ * \param KEY Function-like macro that extracts the sort key from an element.
+ * \param LESS Function-like macro that returns true when its first key sorts first.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define SORT_BY_DEFINE(NAME, T, KEY, LESS) \
+static inline int NAME##_less_(const void *ctx, const T *a, const T *b) { \
+    (void)ctx; \
+    return LESS(KEY(*a), KEY(*b)); \
+} \
+\
+SORT_WITH_CTX_DEFINE(NAME, T, const void *, NAME##_less_) \
+\
+void NAME(T data[], size_t len) { \
+    if (!data || len < 2) { \
+        return; \
+    } \
+    NAME##_sort_(data, len, NULL); \
+}
+
+/*! Upper bound on the worker threads \ref ParallelMergeSort will start. */
+#define PARALLEL_SORT_MAX_THREADS 64
+
+#define PARALLEL_MERGE_SORT_DECLARE(T) \
+void ParallelMergeSort_##T(T A[], size_t len, T temp[], unsigned threads);
+
+    TYPE_ITERATOR(PARALLEL_MERGE_SORT_DECLARE) // Declare parallel merge sort functions
+
+#undef PARALLEL_MERGE_SORT_DECLARE
+
+/*!
+ * \brief Generic macro to perform a multi-threaded, stable merge sort on an array.
+ * \remarks Each thread sorts one contiguous chunk with \ref Array_MergeSort, then the sorted runs are merged pairwise.
+ * Every merge round is split evenly across all threads by co-ranking (binary searching the
+ * split point of each thread's output slice), so even the final merge runs in parallel.
+ * Rounds alternate between A and temp, so nothing is allocated and data is copied back at most once.
+ * Falls back to a serial sort when the array is too small to give each thread a worthwhile chunk,
+ * or when the toolchain lacks C11 threads.
+ *
+ * \param A Array to sort in place.
+ * \param len Number of elements in A.
+ * \param temp Buffer of at least len elements of the same type.
+ * \param threads Number of threads to use (clamped to \ref PARALLEL_SORT_MAX_THREADS).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define ParallelMergeSort(A, len, temp, threads) _Generic((A), \
+    TYPE_PTR_TABLE(ParallelMergeSort) \
+)(A, len, temp, threads)
+
 #define CONVOLVE_DECLARE(T) \
 void convolve_##T(const T x[], size_t x_len, \
                   const T h[], size_t h_len, \
@@ -160,7 +573,10 @@ void convolve_##T(const T x[], size_t x_len, \
 /*!
  * \brief Macro for generic convolution function definitions.
  * \remarks Computes the discrete linear convolution of two sequences.
- * This implementation uses the direct summation method in O(N*M) time complexity.
+ * Integer types always use the direct summation method in O(N*M) time so results stay exact.
+ * Float and double pick between direct summation and an overlap-add FFT in O(N*log(M)) time
+ * depending on x_len and h_len. The FFT path allocates its workspace on the heap;
+ * use \ref convolve_scratch to supply it yourself.
  * \warning The output array y must be preallocated and of sufficient size (at least x_len + h_len - 1).
  * For invalid inputs (NULL pointers or zero lengths), the function does nothing. 
  *
@@ -180,6 +596,49 @@ void convolve_##T(const T x[], size_t x_len, \
     TYPE_PTR_TABLE(convolve) \
 )(x, x_len, h, h_len, y, y_len)
 
+/*!
+ * \brief Returns the workspace size in bytes that \ref convolve_scratch needs.
+ * \remarks A return value of 0 means the direct method will be used and no workspace is needed.
+ * Only the float and double instantiations ever use the workspace.
+ *
+ * \param x_len Number of elements in the input signal.
+ * \param h_len Number of elements in the impulse response.
+ * \return size_t Required workspace size in bytes (suitably aligned for double).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+size_t convolve_scratch_size(size_t x_len, size_t h_len);
+
+#define CONVOLVE_SCRATCH_DECLARE(T) \
+void convolve_scratch_##T(const T x[], size_t x_len, \
+                          const T h[], size_t h_len, \
+                          T y[], size_t y_len, \
+                          void *scratch, size_t scratchSize);
+
+    TYPE_ITERATOR(CONVOLVE_SCRATCH_DECLARE) // Declare convolution functions with caller workspace
+
+#undef CONVOLVE_SCRATCH_DECLARE
+
+/*!
+ * \brief Generic convolution using a caller-provided workspace.
+ * \remarks Same result as \ref convolve but never allocates, which suits hot loops.
+ * If scratch is NULL or smaller than \ref convolve_scratch_size, the direct method is used.
+ *
+ * \param scratch Workspace aligned for double, reusable across calls.
+ * \param scratchSize Size of the workspace in bytes.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define convolve_scratch(x, x_len, h, h_len, y, y_len, scratch, scratchSize) _Generic((x), \
+    TYPE_PTR_TABLE(convolve_scratch) \
+)(x, x_len, h, h_len, y, y_len, scratch, scratchSize)
+
 #ifdef __cplusplus
 }
 #endif
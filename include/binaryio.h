@@ -0,0 +1,366 @@
+/*!
+ * \file binaryio.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Cursor-based binary readers and writers over caller-provided buffers.
+ * \remarks Modeled on .NET's BinaryReader and BinaryWriter, the way bitconverter.h follows BitConverter.
+ * A cursor tracks its position and the byte order of the data, so records can be parsed
+ * or emitted field by field without keeping offsets by hand. Nothing is allocated or copied:
+ * reads decode straight out of the buffer and writes encode straight into it.
+ *
+ * Every checked call either consumes all of its bytes or, on failure, none of them.
+ * For hot loops over fixed-layout records, call \ref br_ensure (or \ref bw_ensure) once per record
+ * and then use the Unchecked variants, which compile to a load or store plus an optional byte swap.
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BINARYIO_H
+#define BINARYIO_H
+
+#include "bitconverter.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! Byte order of the data a cursor reads or writes */
+typedef enum {
+    BINARY_LITTLE_ENDIAN = 0, //!< least significant byte first
+    BINARY_BIG_ENDIAN //!< most significant byte first (network order)
+} BinaryEndian;
+
+/*! Error codes for binary reader and writer functions */
+typedef enum {
+    BINARY_SUCCESS = 0, //!< function completed normally
+    BINARY_END, //!< function terminated because too few bytes remain in the buffer
+    BINARY_INVALID //!< function terminated due to invalid state or parameters
+} BinaryStatus;
+
+/*! Read cursor over a borrowed, read-only buffer */
+typedef struct {
+    const uint8_t *data; //!< Start of the buffer
+    size_t size; //!< Buffer length in bytes
+    size_t pos; //!< Offset of the next byte to read
+    BinaryEndian endian; //!< Byte order of multi-byte values
+} BinaryReader;
+
+/*! Write cursor over a borrowed buffer */
+typedef struct {
+    uint8_t *data; //!< Start of the buffer
+    size_t size; //!< Buffer length in bytes
+    size_t pos; //!< Offset of the next byte to write
+    BinaryEndian endian; //!< Byte order of multi-byte values
+} BinaryWriter;
+
+/*!
+ * \brief Initialize a reader over an existing buffer.
+ *
+ * \param r Pointer to the reader
+ * \param buf Buffer to read from; must outlive the reader
+ * \param size Length of buf in bytes
+ * \param endian Byte order of the data in buf
+ * \return BinaryStatus Indicates success or invalid parameters
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+BinaryStatus br_init(BinaryReader *r, const void *buf, size_t size, BinaryEndian endian);
+
+/*!
+ * \brief Initialize a writer over an existing buffer.
+ *
+ * \param w Pointer to the writer
+ * \param buf Buffer to write into; must outlive the writer
+ * \param size Length of buf in bytes
+ * \param endian Byte order to encode multi-byte values in
+ * \return BinaryStatus Indicates success or invalid parameters
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+BinaryStatus bw_init(BinaryWriter *w, void *buf, size_t size, BinaryEndian endian);
+
+/*! \brief Number of bytes left to read. */
+static inline size_t br_remaining(const BinaryReader *r) {
+    return r->size - r->pos;
+}
+
+/*! \brief Number of bytes left to write. */
+static inline size_t bw_remaining(const BinaryWriter *w) {
+    return w->size - w->pos;
+}
+
+/*!
+ * \brief Checks that at least bytes more bytes can be read.
+ * \remarks One check covers any number of following Unchecked reads totalling at most bytes.
+ */
+static inline bool br_ensure(const BinaryReader *r, size_t bytes) {
+    return bytes <= r->size - r->pos;
+}
+
+/*!
+ * \brief Checks that at least bytes more bytes can be written.
+ * \remarks One check covers any number of following Unchecked writes totalling at most bytes.
+ */
+static inline bool bw_ensure(const BinaryWriter *w, size_t bytes) {
+    return bytes <= w->size - w->pos;
+}
+
+/*! \brief Moves the reader to an absolute offset, up to and including the end of the buffer. */
+BinaryStatus br_seek(BinaryReader *r, size_t pos);
+
+/*! \brief Advances the reader without decoding anything. */
+BinaryStatus br_skip(BinaryReader *r, size_t bytes);
+
+/*! \brief Moves the writer to an absolute offset, e.g. to back-patch a length field. */
+BinaryStatus bw_seek(BinaryWriter *w, size_t pos);
+
+/*! \brief Advances the writer, leaving the skipped bytes unchanged. */
+BinaryStatus bw_skip(BinaryWriter *w, size_t bytes);
+
+/*!
+ * \brief Copies raw bytes out of the reader.
+ *
+ * \param r Pointer to the reader
+ * \param dest Destination for bytes bytes
+ * \param bytes Number of bytes to copy
+ * \return BinaryStatus Indicates success or end of buffer
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+BinaryStatus br_readBytes(BinaryReader *r, void *dest, size_t bytes);
+
+/*!
+ * \brief Borrows the next bytes bytes of the buffer without copying them.
+ * \remarks *view points into the reader's buffer and stays valid as long as that buffer does.
+ *
+ * \param r Pointer to the reader
+ * \param bytes Number of bytes to consume
+ * \param view Receives a pointer to the consumed bytes
+ * \return BinaryStatus Indicates success or end of buffer
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+BinaryStatus br_view(BinaryReader *r, size_t bytes, const uint8_t **view);
+
+/*!
+ * \brief Copies raw bytes into the writer.
+ *
+ * \param w Pointer to the writer
+ * \param src Bytes to copy
+ * \param bytes Number of bytes to copy
+ * \return BinaryStatus Indicates success or end of buffer
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+BinaryStatus bw_writeBytes(BinaryWriter *w, const void *src, size_t bytes);
+
+/*! \brief Reads one byte without a bounds check; see \ref br_ensure. */
+static inline uint8_t br_readUInt8Unchecked(BinaryReader *r) {
+    return r->data[r->pos++];
+}
+
+/*! \brief Reads one byte without a bounds check; see \ref br_ensure. */
+static inline int8_t br_readInt8Unchecked(BinaryReader *r) {
+    return (int8_t)r->data[r->pos++];
+}
+
+/*! \brief Writes one byte without a bounds check; see \ref bw_ensure. */
+static inline void bw_writeUInt8Unchecked(BinaryWriter *w, uint8_t value) {
+    w->data[w->pos++] = value;
+}
+
+/*! \brief Writes one byte without a bounds check; see \ref bw_ensure. */
+static inline void bw_writeInt8Unchecked(BinaryWriter *w, int8_t value) {
+    w->data[w->pos++] = (uint8_t)value;
+}
+
+/*!
+ * \brief Macro for the unchecked per-field accessors of one multi-byte type.
+ * \remarks Generates br_read{NAME}Unchecked(r) and bw_write{NAME}Unchecked(w, value),
+ * which decode or encode in the cursor's byte order and advance it.
+ * The caller guarantees the bytes are available, normally with one \ref br_ensure per record.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define BINARYIO_UNCHECKED_DEFINE(NAME, T) \
+static inline T br_read##NAME##Unchecked(BinaryReader *r) { \
+    const uint8_t *p = r->data + r->pos; \
+    r->pos += sizeof(T); \
+    return (r->endian == BINARY_BIG_ENDIAN) ? BitConverter_To##NAME##BE(p) : BitConverter_To##NAME##LE(p); \
+} \
+static inline void bw_write##NAME##Unchecked(BinaryWriter *w, T value) { \
+    uint8_t *p = w->data + w->pos; \
+    w->pos += sizeof(T); \
+    if (w->endian == BINARY_BIG_ENDIAN) { \
+        BitConverter_Write##NAME##BE(value, p); \
+    } else { \
+        BitConverter_Write##NAME##LE(value, p); \
+    } \
+}
+
+/*! Types the readers and writers can decode and encode, with their BitConverter names. */
+#define BINARYIO_TYPE_MAP(FMACRO) \
+    FMACRO(Int16, int16_t) \
+    FMACRO(UInt16, uint16_t) \
+    FMACRO(Int32, int32_t) \
+    FMACRO(UInt32, uint32_t) \
+    FMACRO(Int64, int64_t) \
+    FMACRO(UInt64, uint64_t) \
+    FMACRO(Float, float) \
+    FMACRO(Double, double)
+
+    BINARYIO_TYPE_MAP(BINARYIO_UNCHECKED_DEFINE)
+
+#undef BINARYIO_UNCHECKED_DEFINE
+
+/*!
+ * \brief Macro for the checked per-field accessors of one type.
+ * \remarks Generates br_read{NAME}(r, &value) and bw_write{NAME}(w, value),
+ * which return \ref BINARY_END without consuming anything when the value does not fit.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define BINARYIO_CHECKED_DEFINE(NAME, T) \
+static inline BinaryStatus br_read##NAME(BinaryReader *r, T *value) { \
+    if (!br_ensure(r, sizeof(T))) { \
+        return BINARY_END; \
+    } \
+    *value = br_read##NAME##Unchecked(r); \
+    return BINARY_SUCCESS; \
+} \
+static inline BinaryStatus bw_write##NAME(BinaryWriter *w, T value) { \
+    if (!bw_ensure(w, sizeof(T))) { \
+        return BINARY_END; \
+    } \
+    bw_write##NAME##Unchecked(w, value); \
+    return BINARY_SUCCESS; \
+}
+
+    BINARYIO_CHECKED_DEFINE(Int8, int8_t)
+    BINARYIO_CHECKED_DEFINE(UInt8, uint8_t)
+    BINARYIO_TYPE_MAP(BINARYIO_CHECKED_DEFINE)
+
+#undef BINARYIO_CHECKED_DEFINE
+
+/*!
+ * \brief Macro for the bulk array functions of one type.
+ * \remarks br_readArray{NAME} copies count elements straight into dest and byte swaps them there
+ * when the data's byte order differs from the host's, using the vectorized
+ * \ref BitConverter_ReverseArray. bw_writeArray{NAME} does the reverse.
+ * Either checks bounds once for the whole array.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define BINARYIO_ARRAY_DECLARE(NAME, T) \
+BinaryStatus br_readArray##NAME(BinaryReader *r, T dest[], size_t count); \
+BinaryStatus bw_writeArray##NAME(BinaryWriter *w, const T src[], size_t count);
+
+    BINARYIO_ARRAY_DECLARE(Int8, int8_t)
+    BINARYIO_ARRAY_DECLARE(UInt8, uint8_t)
+    BINARYIO_TYPE_MAP(BINARYIO_ARRAY_DECLARE)
+
+#undef BINARYIO_ARRAY_DECLARE
+
+/*!
+ * \brief Generic macro to read one value into *ptr.
+ * \remarks The value's type is taken from the pointer, e.g. a uint32_t* reads four bytes.
+ */
+#define br_read(r, ptr) _Generic((ptr), \
+    int8_t*: br_readInt8, \
+    uint8_t*: br_readUInt8, \
+    int16_t*: br_readInt16, \
+    uint16_t*: br_readUInt16, \
+    int32_t*: br_readInt32, \
+    uint32_t*: br_readUInt32, \
+    int64_t*: br_readInt64, \
+    uint64_t*: br_readUInt64, \
+    float*: br_readFloat, \
+    double*: br_readDouble \
+)(r, ptr)
+
+/*!
+ * \brief Generic macro to write one value.
+ * \remarks The encoding follows the value's type, so cast literals, e.g. bw_write(w, (uint16_t)7).
+ */
+#define bw_write(w, value) _Generic((value), \
+    int8_t: bw_writeInt8, \
+    uint8_t: bw_writeUInt8, \
+    int16_t: bw_writeInt16, \
+    uint16_t: bw_writeUInt16, \
+    int32_t: bw_writeInt32, \
+    uint32_t: bw_writeUInt32, \
+    int64_t: bw_writeInt64, \
+    uint64_t: bw_writeUInt64, \
+    float: bw_writeFloat, \
+    double: bw_writeDouble \
+)(w, value)
+
+/*! \brief Generic macro to read count elements into a typed array. */
+#define br_readArray(r, dest, count) _Generic((dest), \
+    int8_t*: br_readArrayInt8, \
+    uint8_t*: br_readArrayUInt8, \
+    int16_t*: br_readArrayInt16, \
+    uint16_t*: br_readArrayUInt16, \
+    int32_t*: br_readArrayInt32, \
+    uint32_t*: br_readArrayUInt32, \
+    int64_t*: br_readArrayInt64, \
+    uint64_t*: br_readArrayUInt64, \
+    float*: br_readArrayFloat, \
+    double*: br_readArrayDouble \
+)(r, dest, count)
+
+/*! \brief Generic macro to write count elements from a typed array. */
+#define bw_writeArray(w, src, count) _Generic((src), \
+    int8_t*: bw_writeArrayInt8, \
+    uint8_t*: bw_writeArrayUInt8, \
+    int16_t*: bw_writeArrayInt16, \
+    uint16_t*: bw_writeArrayUInt16, \
+    int32_t*: bw_writeArrayInt32, \
+    uint32_t*: bw_writeArrayUInt32, \
+    int64_t*: bw_writeArrayInt64, \
+    uint64_t*: bw_writeArrayUInt64, \
+    float*: bw_writeArrayFloat, \
+    double*: bw_writeArrayDouble, \
+    const int8_t*: bw_writeArrayInt8, \
+    const uint8_t*: bw_writeArrayUInt8, \
+    const int16_t*: bw_writeArrayInt16, \
+    const uint16_t*: bw_writeArrayUInt16, \
+    const int32_t*: bw_writeArrayInt32, \
+    const uint32_t*: bw_writeArrayUInt32, \
+    const int64_t*: bw_writeArrayInt64, \
+    const uint64_t*: bw_writeArrayUInt64, \
+    const float*: bw_writeArrayFloat, \
+    const double*: bw_writeArrayDouble \
+)(w, src, count)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BINARYIO_H
@@ -1,9 +1,11 @@
 #ifndef BITCONVERTER_H
 #define BITCONVERTER_H
 
+#include "bitops.h"
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,10 +20,39 @@ typedef uint32_t UInt32, uint32, u32;
 typedef int32_t Int32, int32, i32;
 typedef uint64_t UInt64, uint64, u64;
 
-extern bool g_is_little_endian; //!< Set by BitConverter_Init()
+/*!
+ * \brief Host byte order, detected at compile time where the toolchain reports it.
+ * \remarks Defined to 1 on little-endian and 0 on big-endian targets.
+ * When neither the compiler nor the platform identifies the byte order it stays undefined,
+ * and the accessors below fall back to a check the optimizer folds to a constant.
+ */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && defined(__ORDER_BIG_ENDIAN__)
+#define CMOR_LITTLE_ENDIAN (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#elif defined(_WIN32) || defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86) || \
+      defined(_M_ARM64) || defined(_M_ARM)
+#define CMOR_LITTLE_ENDIAN 1
+#endif
+
+/*! \brief Checks the host byte order at run time; only used when \ref CMOR_LITTLE_ENDIAN is unknown. */
+static inline bool BitConverter_HostIsLittle(void) {
+    const uint16_t one = 1;
+    uint8_t first;
+    memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+#ifdef CMOR_LITTLE_ENDIAN
+#define BITCONVERTER_HOST_LITTLE CMOR_LITTLE_ENDIAN
+#else
+#define BITCONVERTER_HOST_LITTLE BitConverter_HostIsLittle()
+#endif
+
+extern bool g_is_little_endian; //!< Host byte order, kept for compatibility. No longer read by this library.
 
 /*!
  * \brief Initializes the BitCovnerter library, detecting endianness.
+ * \remarks Only sets \ref g_is_little_endian. Byte order is now known at compile time,
+ * so none of the conversion functions depend on this being called.
  * 
  * \version 0.1
  * \author William (116991920+wdg0008@users.noreply.github.com)
@@ -32,6 +63,7 @@ void BitConverter_Init();
 
 /*!
  * \brief Returns the base-2 logarithm of an integer value, rounded down.
+ * \remarks Returns 0 for zero. A single bsr/lzcnt via \ref bitops_log2Floor_uint64_t.
  * 
  * \param value 
  * \return uint8_t 
@@ -40,10 +72,12 @@ void BitConverter_Init();
  * \date 2025-08-31
  * \copyright Copyright (c) 2025
  */
-uint8_t BitConverter_Log2Int(uint64_t value);
+static inline uint8_t BitConverter_Log2Int(uint64_t value) {
+    return (uint8_t)bitops_log2Floor_uint64_t(value);
+}
 
 /*! \brief Datects whether an integer is a power of 2 */
-inline bool BitConverter_IsPow2(uint64_t value) {
+static inline bool BitConverter_IsPow2(uint64_t value) {
     return value && !(value & (value - 1));
 }
 
@@ -95,6 +129,79 @@ uint64_t BitConverter_UInt64FromDouble(double value);
  */
 uint32_t BitConverter_UInt32FromFloat(float value);
 
+/*!
+ * \brief Converts a float to IEEE 754 binary16 (half precision) bits.
+ * \remarks Rounds to nearest, ties to even. Values beyond the half range become infinity,
+ * values below it become signed zero or a subnormal half, and NaNs stay NaN
+ * (quieted, keeping the top payload bits), so the result matches the F16C instructions bit for bit.
+ *
+ * \param value The float to convert.
+ * \return uint16_t The binary16 bit pattern.
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+uint16_t BitConverter_HalfFromFloat(float value);
+
+/*!
+ * \brief Converts IEEE 754 binary16 (half precision) bits to a float.
+ * \remarks Exact: every half, subnormals included, is representable as a float. Signaling NaNs come back quieted.
+ *
+ * \param value The binary16 bit pattern.
+ * \return float The converted value.
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+float BitConverter_FloatFromHalf(uint16_t value);
+
+/*!
+ * \brief Converts a float to bfloat16 bits (the upper half of a float, with 8 mantissa bits).
+ * \remarks Rounds to nearest, ties to even; subnormals are kept and NaNs stay NaN (quieted).
+ *
+ * \param value The float to convert.
+ * \return uint16_t The bfloat16 bit pattern.
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+uint16_t BitConverter_BFloat16FromFloat(float value);
+
+/*!
+ * \brief Converts bfloat16 bits to a float. Exact.
+ *
+ * \param value The bfloat16 bit pattern.
+ * \return float The converted value.
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+float BitConverter_FloatFromBFloat16(uint16_t value);
+
+/*!
+ * \brief Bulk forms of the 16-bit float conversions.
+ * \remarks Results are identical to the scalar functions. Half conversions use the F16C or AVX-512
+ * conversion instructions and bfloat16 conversions use AVX2 or AVX-512 integer kernels, picked at
+ * run time, so converting a buffer stays memory bound. dst and src must not overlap.
+ *
+ * \param dst Array receiving count converted values.
+ * \param src Array of count values to convert.
+ * \param count Number of elements.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+void BitConverter_HalfFromFloatArray(uint16_t dst[], const float src[], size_t count);
+void BitConverter_FloatFromHalfArray(float dst[], const uint16_t src[], size_t count);
+void BitConverter_BFloat16FromFloatArray(uint16_t dst[], const float src[], size_t count);
+void BitConverter_FloatFromBFloat16Array(float dst[], const uint16_t src[], size_t count);
+
 /*!
  * \brief Generic macro to extract bytes from various data types.
  * \param x The value to convert to bytes.
@@ -188,6 +295,143 @@ uint64_t BitConverter_Reverse_UInt64(uint64_t value);
 float BitConverter_Reverse_Float(float value);
 double BitConverter_Reverse_Double(double value);
 
+/*!
+ * \brief Reverses the byte order of every element of an array.
+ * \remarks Use this to convert whole payloads between big- and little-endian.
+ * Elements are shuffled 32 bytes at a time with AVX2 (or 16 with SSSE3) when the CPU supports it,
+ * chosen at run time, and one at a time otherwise.
+ * \warning dst and src may be the same array (in-place conversion), but must not partially overlap.
+ *
+ * \param dst Array receiving count byte-swapped elements.
+ * \param src Array of count elements to read.
+ * \param count Number of elements (not bytes).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define BitConverter_ReverseArray(dst, src, count) _Generic((dst), \
+    int16_t*: BitConverter_ReverseArray_Int16, \
+    int32_t*: BitConverter_ReverseArray_Int32, \
+    int64_t*: BitConverter_ReverseArray_Int64, \
+    uint16_t*: BitConverter_ReverseArray_UInt16, \
+    uint32_t*: BitConverter_ReverseArray_UInt32, \
+    uint64_t*: BitConverter_ReverseArray_UInt64, \
+    float*: BitConverter_ReverseArray_Float, \
+    double*: BitConverter_ReverseArray_Double \
+)(dst, src, count)
+
+void BitConverter_ReverseArray_Int16(int16_t dst[], const int16_t src[], size_t count);
+void BitConverter_ReverseArray_Int32(int32_t dst[], const int32_t src[], size_t count);
+void BitConverter_ReverseArray_Int64(int64_t dst[], const int64_t src[], size_t count);
+void BitConverter_ReverseArray_UInt16(uint16_t dst[], const uint16_t src[], size_t count);
+void BitConverter_ReverseArray_UInt32(uint32_t dst[], const uint32_t src[], size_t count);
+void BitConverter_ReverseArray_UInt64(uint64_t dst[], const uint64_t src[], size_t count);
+void BitConverter_ReverseArray_Float(float dst[], const float src[], size_t count);
+void BitConverter_ReverseArray_Double(double dst[], const double src[], size_t count);
+
+/*!
+ * \brief Untyped form of \ref BitConverter_ReverseArray for buffers of unknown alignment.
+ * \remarks Swaps count elements of elementSize bytes each (1, 2, 4 or 8), e.g. fields inside a packed record buffer.
+ * An elementSize of 1 just copies. Other sizes do nothing.
+ */
+void BitConverter_ReverseArray_Bytes(void *dst, const void *src, size_t count, size_t elementSize);
+
+/*!
+ * \brief Reverses the byte order of an unsigned integer.
+ * \remarks Inlined to a single bswap (or rev) instruction on GCC and Clang.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+static inline uint16_t BitConverter_Bswap16(uint16_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(value);
+#else
+    return (uint16_t)((value >> 8) | (value << 8));
+#endif
+}
+
+/*! \brief Reverses the byte order of an unsigned integer. */
+static inline uint32_t BitConverter_Bswap32(uint32_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(value);
+#else
+    return ((value >> 24) & 0xFFu) | ((value >> 8) & 0xFF00u) |
+           ((value << 8) & 0xFF0000u) | ((value << 24) & 0xFF000000u);
+#endif
+}
+
+/*! \brief Reverses the byte order of an unsigned integer. */
+static inline uint64_t BitConverter_Bswap64(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#else
+    return ((uint64_t)BitConverter_Bswap32((uint32_t)value) << 32) | BitConverter_Bswap32((uint32_t)(value >> 32));
+#endif
+}
+
+#define BITCONVERTER_LE(BITS, v) (BITCONVERTER_HOST_LITTLE ? (v) : BitConverter_Bswap##BITS(v))
+#define BITCONVERTER_BE(BITS, v) (BITCONVERTER_HOST_LITTLE ? BitConverter_Bswap##BITS(v) : (v))
+
+/*!
+ * \brief Macro for the explicit little- and big-endian accessors of one type.
+ * \remarks Generates BitConverter_To{NAME}{LE,BE}(bytes) and BitConverter_Write{NAME}{LE,BE}(value, bytes).
+ * Each is a single unaligned load or store plus a byte swap when the requested order differs from the host's,
+ * with no dependence on \ref g_is_little_endian, so decode loops inline and vectorize.
+ * bytes needs no particular alignment.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define BITCONVERTER_ACCESSOR_DEFINE(NAME, T, BITS) \
+static inline T BitConverter_To##NAME##LE(const uint8_t bytes[]) { \
+    uint##BITS##_t raw; \
+    T value; \
+    memcpy(&raw, bytes, sizeof raw); \
+    raw = BITCONVERTER_LE(BITS, raw); \
+    memcpy(&value, &raw, sizeof value); \
+    return value; \
+} \
+static inline T BitConverter_To##NAME##BE(const uint8_t bytes[]) { \
+    uint##BITS##_t raw; \
+    T value; \
+    memcpy(&raw, bytes, sizeof raw); \
+    raw = BITCONVERTER_BE(BITS, raw); \
+    memcpy(&value, &raw, sizeof value); \
+    return value; \
+} \
+static inline void BitConverter_Write##NAME##LE(T value, uint8_t bytes[]) { \
+    uint##BITS##_t raw; \
+    memcpy(&raw, &value, sizeof raw); \
+    raw = BITCONVERTER_LE(BITS, raw); \
+    memcpy(bytes, &raw, sizeof raw); \
+} \
+static inline void BitConverter_Write##NAME##BE(T value, uint8_t bytes[]) { \
+    uint##BITS##_t raw; \
+    memcpy(&raw, &value, sizeof raw); \
+    raw = BITCONVERTER_BE(BITS, raw); \
+    memcpy(bytes, &raw, sizeof raw); \
+}
+
+    BITCONVERTER_ACCESSOR_DEFINE(Int16, int16_t, 16)
+    BITCONVERTER_ACCESSOR_DEFINE(UInt16, uint16_t, 16)
+    BITCONVERTER_ACCESSOR_DEFINE(Int32, int32_t, 32)
+    BITCONVERTER_ACCESSOR_DEFINE(UInt32, uint32_t, 32)
+    BITCONVERTER_ACCESSOR_DEFINE(Int64, int64_t, 64)
+    BITCONVERTER_ACCESSOR_DEFINE(UInt64, uint64_t, 64)
+    BITCONVERTER_ACCESSOR_DEFINE(Float, float, 32)
+    BITCONVERTER_ACCESSOR_DEFINE(Double, double, 64)
+
+#undef BITCONVERTER_ACCESSOR_DEFINE
+#undef BITCONVERTER_LE
+#undef BITCONVERTER_BE
+
 /*!
  * \brief Concatenates two smaller values into a larger one.
  * \param x The high part or upper half.
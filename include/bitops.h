@@ -0,0 +1,242 @@
+/*!
+ * \file bitops.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Bit manipulation for the fixed-width integer types.
+ * \remarks Generated for every type of \ref STDINT_TYPE_MAP. Signed types are operated on as their
+ * two's complement bit pattern. The single-value operations are inline over the GCC and Clang
+ * builtins, with portable fallbacks for other compilers; the builtins become popcnt, lzcnt and
+ * tzcnt only when the build targets a CPU that has them (e.g. -march=native), and otherwise a
+ * bsr/bsf or a short bit-twiddling sequence. Only bit extract/deposit (BMI2 pext/pdep) and
+ * \ref bitops_popcountArray (AVX-512 or AVX2 kernels) check the CPU at run time.
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BITOPS_H
+#define BITOPS_H
+
+#include "metamacros.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BITOPS_BUILTINS 1
+#else
+#define BITOPS_BUILTINS 0
+#endif
+
+/*! Unsigned type of the same width for each \ref STDINT_TYPE_MAP suffix */
+#define BITOPS_UNSIGNED_i8 uint8_t
+#define BITOPS_UNSIGNED_i16 uint16_t
+#define BITOPS_UNSIGNED_i32 uint32_t
+#define BITOPS_UNSIGNED_i64 uint64_t
+#define BITOPS_UNSIGNED_u8 uint8_t
+#define BITOPS_UNSIGNED_u16 uint16_t
+#define BITOPS_UNSIGNED_u32 uint32_t
+#define BITOPS_UNSIGNED_u64 uint64_t
+
+/*! \brief Number of set bits. */
+static inline unsigned bitops_popcount64(uint64_t value) {
+#if BITOPS_BUILTINS
+    return (unsigned)__builtin_popcountll(value);
+#else
+    value -= (value >> 1) & UINT64_C(0x5555555555555555);
+    value = (value & UINT64_C(0x3333333333333333)) + ((value >> 2) & UINT64_C(0x3333333333333333));
+    value = (value + (value >> 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+    return (unsigned)((value * UINT64_C(0x0101010101010101)) >> 56);
+#endif
+}
+
+/*! \brief Number of leading zero bits; 64 for zero. */
+static inline unsigned bitops_clz64(uint64_t value) {
+#if BITOPS_BUILTINS
+    return value ? (unsigned)__builtin_clzll(value) : 64;
+#else
+    unsigned n = 0;
+    if (!value) {
+        return 64;
+    }
+    for (unsigned step = 32; step > 0; step >>= 1) {
+        if (!(value >> (64 - step))) {
+            n += step;
+            value <<= step;
+        }
+    }
+    return n;
+#endif
+}
+
+/*! \brief Number of trailing zero bits; 64 for zero. */
+static inline unsigned bitops_ctz64(uint64_t value) {
+#if BITOPS_BUILTINS
+    return value ? (unsigned)__builtin_ctzll(value) : 64;
+#else
+    return value ? bitops_popcount64((value & (0 - value)) - 1) : 64;
+#endif
+}
+
+/*! \brief Reverses the order of all 64 bits. */
+static inline uint64_t bitops_reverse64(uint64_t value) {
+    value = ((value >> 1) & UINT64_C(0x5555555555555555)) | ((value & UINT64_C(0x5555555555555555)) << 1);
+    value = ((value >> 2) & UINT64_C(0x3333333333333333)) | ((value & UINT64_C(0x3333333333333333)) << 2);
+    value = ((value >> 4) & UINT64_C(0x0F0F0F0F0F0F0F0F)) | ((value & UINT64_C(0x0F0F0F0F0F0F0F0F)) << 4);
+#if BITOPS_BUILTINS
+    return __builtin_bswap64(value);
+#else
+    value = ((value >> 8) & UINT64_C(0x00FF00FF00FF00FF)) | ((value & UINT64_C(0x00FF00FF00FF00FF)) << 8);
+    value = ((value >> 16) & UINT64_C(0x0000FFFF0000FFFF)) | ((value & UINT64_C(0x0000FFFF0000FFFF)) << 16);
+    return (value >> 32) | (value << 32);
+#endif
+}
+
+/*!
+ * \brief Macro for the inline bit operations on one type.
+ * \remarks For a type of N bits:
+ * - bitops_popcount_##T: number of set bits.
+ * - bitops_clz_##T / bitops_ctz_##T: leading / trailing zero bits, N for zero.
+ * - bitops_parity_##T: 1 if an odd number of bits is set.
+ * - bitops_log2Floor_##T / bitops_log2Ceil_##T: floor and ceiling of log2 of the unsigned value, 0 for zero.
+ * - bitops_nextPow2_##T: smallest power of two not below the unsigned value (1 for zero),
+ *   or 0 if that does not fit in N bits.
+ * - bitops_reverse_##T: the N bits in reverse order.
+ * - bitops_rotl_##T / bitops_rotr_##T: rotation by count modulo N.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define BITOPS_DEFINE(suf, T) \
+static inline unsigned bitops_popcount_##T(T value) { \
+    return bitops_popcount64((BITOPS_UNSIGNED_##suf)value); \
+} \
+\
+static inline unsigned bitops_clz_##T(T value) { \
+    return bitops_clz64((BITOPS_UNSIGNED_##suf)value) - (unsigned)(64 - 8 * sizeof(T)); \
+} \
+\
+static inline unsigned bitops_ctz_##T(T value) { \
+    return value ? bitops_ctz64((BITOPS_UNSIGNED_##suf)value) : (unsigned)(8 * sizeof(T)); \
+} \
+\
+static inline unsigned bitops_parity_##T(T value) { \
+    return bitops_popcount64((BITOPS_UNSIGNED_##suf)value) & 1; \
+} \
+\
+static inline unsigned bitops_log2Floor_##T(T value) { \
+    const BITOPS_UNSIGNED_##suf bits = (BITOPS_UNSIGNED_##suf)value; \
+    return bits ? 63 - bitops_clz64(bits) : 0; \
+} \
+\
+static inline unsigned bitops_log2Ceil_##T(T value) { \
+    const BITOPS_UNSIGNED_##suf bits = (BITOPS_UNSIGNED_##suf)value; \
+    return bits > 1 ? 64 - bitops_clz64((uint64_t)bits - 1) : 0; \
+} \
+\
+static inline T bitops_nextPow2_##T(T value) { \
+    const unsigned shift = bitops_log2Ceil_##T(value); \
+    return shift < 8 * sizeof(T) ? (T)(BITOPS_UNSIGNED_##suf)((BITOPS_UNSIGNED_##suf)1 << shift) : (T)0; \
+} \
+\
+static inline T bitops_reverse_##T(T value) { \
+    return (T)(BITOPS_UNSIGNED_##suf)(bitops_reverse64((BITOPS_UNSIGNED_##suf)value) >> (64 - 8 * sizeof(T))); \
+} \
+\
+static inline T bitops_rotl_##T(T value, unsigned count) { \
+    const BITOPS_UNSIGNED_##suf bits = (BITOPS_UNSIGNED_##suf)value; \
+    const unsigned n = count & (8 * sizeof(T) - 1); \
+    return (T)(BITOPS_UNSIGNED_##suf)((BITOPS_UNSIGNED_##suf)(bits << n) | \
+                                      (BITOPS_UNSIGNED_##suf)(bits >> ((8 * sizeof(T) - n) & (8 * sizeof(T) - 1)))); \
+} \
+\
+static inline T bitops_rotr_##T(T value, unsigned count) { \
+    return bitops_rotl_##T(value, (unsigned)(8 * sizeof(T)) - (count & (8 * sizeof(T) - 1))); \
+}
+
+    STDINT_TYPE_MAP(BITOPS_DEFINE)
+
+#undef BITOPS_DEFINE
+
+/*!
+ * \brief Macro for the bit extract / deposit declarations.
+ * \remarks bitops_extract_##T gathers the bits of value selected by mask into the low bits of the
+ * result (BMI2 pext). bitops_deposit_##T scatters the low bits of value to the positions set in mask
+ * (BMI2 pdep). Both fall back to a loop over the set bits of mask without BMI2.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define BITOPS_PDEP_DECLARE(suf, T) \
+T bitops_extract_##T(T value, T mask); \
+T bitops_deposit_##T(T value, T mask);
+
+    STDINT_TYPE_MAP(BITOPS_PDEP_DECLARE)
+
+#undef BITOPS_PDEP_DECLARE
+
+/*!
+ * \brief Counts the set bits in a buffer.
+ * \remarks Uses AVX-512 VPOPCNTDQ, an AVX2 nibble-lookup kernel, or popcnt, picked at run time.
+ *
+ * \param data Buffer to count; needs no particular alignment.
+ * \param bytes Size of the buffer in bytes.
+ * \return size_t Total number of set bits.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+size_t bitops_popcountArray(const void *data, size_t bytes);
+
+/*! \brief Generic macro for the number of set bits. */
+#define bitops_popcount(x) _Generic((x), STDINT_TYPE_TABLE(bitops_popcount))(x)
+
+/*! \brief Generic macro for the number of leading zero bits (the type width for zero). */
+#define bitops_clz(x) _Generic((x), STDINT_TYPE_TABLE(bitops_clz))(x)
+
+/*! \brief Generic macro for the number of trailing zero bits (the type width for zero). */
+#define bitops_ctz(x) _Generic((x), STDINT_TYPE_TABLE(bitops_ctz))(x)
+
+/*! \brief Generic macro for the parity (1 if an odd number of bits is set). */
+#define bitops_parity(x) _Generic((x), STDINT_TYPE_TABLE(bitops_parity))(x)
+
+/*! \brief Generic macro for floor(log2(x)), 0 for zero. */
+#define bitops_log2Floor(x) _Generic((x), STDINT_TYPE_TABLE(bitops_log2Floor))(x)
+
+/*! \brief Generic macro for ceil(log2(x)), 0 for zero. */
+#define bitops_log2Ceil(x) _Generic((x), STDINT_TYPE_TABLE(bitops_log2Ceil))(x)
+
+/*! \brief Generic macro for the smallest power of two not below x, or 0 on overflow. */
+#define bitops_nextPow2(x) _Generic((x), STDINT_TYPE_TABLE(bitops_nextPow2))(x)
+
+/*! \brief Generic macro to reverse the bit order. */
+#define bitops_reverse(x) _Generic((x), STDINT_TYPE_TABLE(bitops_reverse))(x)
+
+/*! \brief Generic macro to rotate left by count bits. */
+#define bitops_rotl(x, count) _Generic((x), STDINT_TYPE_TABLE(bitops_rotl))(x, count)
+
+/*! \brief Generic macro to rotate right by count bits. */
+#define bitops_rotr(x, count) _Generic((x), STDINT_TYPE_TABLE(bitops_rotr))(x, count)
+
+/*! \brief Generic macro to gather the bits of x selected by mask (pext). */
+#define bitops_extract(x, mask) _Generic((x), STDINT_TYPE_TABLE(bitops_extract))(x, mask)
+
+/*! \brief Generic macro to scatter the low bits of x to the positions set in mask (pdep). */
+#define bitops_deposit(x, mask) _Generic((x), STDINT_TYPE_TABLE(bitops_deposit))(x, mask)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BITOPS_H
@@ -0,0 +1,150 @@
+/*!
+ * \file bitpack.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Bit-packing integer compression with delta and frame-of-reference preprocessing.
+ * \remarks Generated for the integer types of \ref TYPE_ITERATOR.
+ *
+ * Values are packed in blocks of \ref BITPACK_BLOCK, each with its own bit width, so a burst of large
+ * values only costs space in the blocks it touches. A block is stored as a one-byte width,
+ * a reference value (little-endian, sizeof(T) bytes), and the packed residuals.
+ * Full blocks interleave their values across four 32-bit lanes (two 64-bit lanes for 64-bit types)
+ * so they unpack with SIMD shifts and masks; a final partial block is packed as a plain bit stream.
+ *
+ * Preprocessing, chosen per call with \ref BitpackMode:
+ * - \ref BITPACK_NONE packs the raw values.
+ * - \ref BITPACK_FOR subtracts each block's minimum first (frame of reference), so clustered values
+ *   such as sensor readings pack into the width of their spread instead of their magnitude.
+ * - \ref BITPACK_DELTA stores differences between consecutive values, then applies frame of reference
+ *   to those, so slowly changing or monotonic series (timestamps, counters) pack into a few bits.
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BITPACK_H
+#define BITPACK_H
+
+#include "metamacros.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BITPACK_BLOCK 128 //!< values per block; each block picks its own bit width
+
+/*! Preprocessing applied before packing */
+typedef enum {
+    BITPACK_NONE = 0, //!< pack the values as they are
+    BITPACK_FOR, //!< subtract the block minimum (frame of reference)
+    BITPACK_DELTA //!< pack differences between consecutive values, with frame of reference
+} BitpackMode;
+
+/*! Error codes for bit-packing functions */
+typedef enum {
+    BITPACK_SUCCESS = 0, //!< function completed normally
+    BITPACK_END, //!< function terminated because the output buffer filled up or the input ended early
+    BITPACK_CORRUPT, //!< function terminated because a block header is not valid for the type
+    BITPACK_INVALID //!< function terminated due to invalid parameters
+} BitpackStatus;
+
+/*!
+ * \brief Upper bound on the encoded size of count values of elementSize bytes, for sizing output buffers.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+size_t bitpack_max_size(size_t count, size_t elementSize);
+
+/*!
+ * \brief Macro for the bit-packing function declarations.
+ * \remarks bitpack_encode_##T packs count values and reports the bytes written.
+ * bitpack_decode_##T unpacks exactly count values, which must have been encoded with the same
+ * type and mode, and reports the bytes consumed.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define BITPACK_DECLARE(suf, T) \
+BitpackStatus bitpack_encode_##T(const T src[], size_t count, BitpackMode mode, \
+                                 uint8_t out[], size_t outSize, size_t *written); \
+BitpackStatus bitpack_decode_##T(const uint8_t in[], size_t inSize, BitpackMode mode, \
+                                 T dst[], size_t count, size_t *consumed);
+
+    STDINT_TYPE_MAP(BITPACK_DECLARE)
+
+#undef BITPACK_DECLARE
+
+#define BITPACK_INT_PTR_TABLE(FUNC) \
+    FPTR_MAP(FUNC, int8_t), \
+    FPTR_MAP(FUNC, int16_t), \
+    FPTR_MAP(FUNC, int32_t), \
+    FPTR_MAP(FUNC, int64_t), \
+    FPTR_MAP(FUNC, uint8_t), \
+    FPTR_MAP(FUNC, uint16_t), \
+    FPTR_MAP(FUNC, uint32_t), \
+    FPTR_MAP(FUNC, uint64_t)
+
+#define BITPACK_CONST_PTR_TABLE(FUNC) \
+    const int8_t*: FUNC##_int8_t, \
+    const int16_t*: FUNC##_int16_t, \
+    const int32_t*: FUNC##_int32_t, \
+    const int64_t*: FUNC##_int64_t, \
+    const uint8_t*: FUNC##_uint8_t, \
+    const uint16_t*: FUNC##_uint16_t, \
+    const uint32_t*: FUNC##_uint32_t, \
+    const uint64_t*: FUNC##_uint64_t
+
+/*!
+ * \brief Generic macro to compress an integer array.
+ *
+ * \param src Values to encode.
+ * \param count Number of values.
+ * \param mode Preprocessing to apply, see \ref BitpackMode.
+ * \param out Output buffer; \ref bitpack_max_size bytes always suffice.
+ * \param outSize Size of out in bytes.
+ * \param written Receives the number of bytes written (may be NULL).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define bitpack_encode(src, count, mode, out, outSize, written) _Generic((src), \
+    BITPACK_INT_PTR_TABLE(bitpack_encode), \
+    BITPACK_CONST_PTR_TABLE(bitpack_encode) \
+)(src, count, mode, out, outSize, written)
+
+/*!
+ * \brief Generic macro to decompress an integer array.
+ * \remarks Full blocks are unpacked with SSE2 where available.
+ *
+ * \param in Encoded bytes.
+ * \param inSize Number of bytes available in in.
+ * \param mode Preprocessing the data was encoded with.
+ * \param dst Array receiving count values.
+ * \param count Number of values to decode.
+ * \param consumed Receives the number of bytes read (may be NULL).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define bitpack_decode(in, inSize, mode, dst, count, consumed) _Generic((dst), \
+    BITPACK_INT_PTR_TABLE(bitpack_decode) \
+)(in, inSize, mode, dst, count, consumed)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BITPACK_H
@@ -0,0 +1,151 @@
+/*!
+ * \file fir.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Streaming finite impulse response filters for block-at-a-time convolution.
+ * \remarks Generated for every type in \ref TYPE_ITERATOR, like the functions in array.h.
+ *
+ * A filter borrows its taps and keeps the last tapCount - 1 input samples in a caller-provided
+ * state buffer, so an unbounded stream can be filtered in constant memory.
+ * Feeding a signal through \ref fir_process in blocks of any size, then calling \ref fir_flush,
+ * produces the samples of one-shot \ref convolve on the whole signal: bit for bit for the integer
+ * types, and for float and double bit for bit against the direct path (\ref convolve_scratch with
+ * NULL scratch). Where \ref convolve_scratch_size is nonzero, float and double \ref convolve takes
+ * its FFT path instead, and the two agree only to rounding.
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+
+#ifndef FIR_H
+#define FIR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "metamacros.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! Error codes for FIR filter functions */
+typedef enum {
+    FIR_SUCCESS = 0, //!< function completed normally
+    FIR_INVALID //!< function terminated due to invalid state or parameters
+} FirStatus;
+
+/*! Declare FIR filter types */
+#define FIR_DECLARE(T) \
+/*! Streaming FIR filter state */ \
+typedef struct { \
+    const T *taps; /*!< impulse response, borrowed from the caller */ \
+    size_t tapCount; /*!< number of taps */ \
+    T *history; /*!< last tapCount - 1 input samples, oldest first */ \
+    size_t primed; /*!< number of valid samples in history */ \
+} FirFilter_##T;
+
+    TYPE_ITERATOR(FIR_DECLARE) // declare FIR filter struct types
+
+#undef FIR_DECLARE
+
+#define FIR_FUNC_DECLARE(T) \
+FirStatus fir_init_##T(FirFilter_##T *f, const T taps[], size_t tapCount, T state[], size_t stateLen); \
+FirStatus fir_process_##T(FirFilter_##T *f, const T in[], T out[], size_t n); \
+FirStatus fir_flush_##T(FirFilter_##T *f, T out[], size_t outLen); \
+FirStatus fir_reset_##T(FirFilter_##T *f);
+
+    TYPE_ITERATOR(FIR_FUNC_DECLARE) // declare FIR functions for all the types
+
+#undef FIR_FUNC_DECLARE
+
+/*! Maps a function to a pointer to the FIR filter of a supported type for _Generic usage. */
+#define FIR_PTR_MAP(FUNC, T) FirFilter_##T *: FUNC##_##T
+
+/*! Expands a _Generic mapping over the FIR filters of all supported types. */
+#define FIR_TYPE_TABLE(FUNC) \
+    FIR_PTR_MAP(FUNC, int8_t), \
+    FIR_PTR_MAP(FUNC, int16_t), \
+    FIR_PTR_MAP(FUNC, int32_t), \
+    FIR_PTR_MAP(FUNC, int64_t), \
+    FIR_PTR_MAP(FUNC, uint8_t), \
+    FIR_PTR_MAP(FUNC, uint16_t), \
+    FIR_PTR_MAP(FUNC, uint32_t), \
+    FIR_PTR_MAP(FUNC, uint64_t), \
+    FIR_PTR_MAP(FUNC, float), \
+    FIR_PTR_MAP(FUNC, double)
+
+/*!
+ * \brief Initialize a filter with its taps and an external state buffer
+ * 
+ * \param f Pointer to the filter to initialize
+ * \param taps Impulse response; must stay valid for the lifetime of the filter
+ * \param tapCount Number of taps (at least 1)
+ * \param state Buffer for the input history (may be NULL when tapCount is 1)
+ * \param stateLen Number of elements in state (at least tapCount - 1)
+ * \return FirStatus Error code indicating success or describing failure
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define fir_init(f, taps, tapCount, state, stateLen) _Generic((f), \
+    FIR_TYPE_TABLE(fir_init) \
+)(f, taps, tapCount, state, stateLen)
+
+/*!
+ * \brief Filter a block of samples, producing one output per input
+ * \remarks The history carries across calls, so block boundaries do not affect the output.
+ * Sums run oldest sample first in the element type, matching the direct path of \ref convolve
+ * exactly. Long float kernels, where \ref convolve switches to its FFT path, agree to rounding.
+ * 
+ * \param f Pointer to the filter
+ * \param in Block of input samples
+ * \param out Buffer for n output samples (must not overlap in)
+ * \param n Number of samples in the block
+ * \return FirStatus Error code indicating success or describing failure
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define fir_process(f, in, out, n) _Generic((f), \
+    FIR_TYPE_TABLE(fir_process) \
+)(f, in, out, n)
+
+/*!
+ * \brief Emit the tapCount - 1 tail samples of the convolution and reset the filter
+ * 
+ * \param f Pointer to the filter
+ * \param out Buffer for the tail samples
+ * \param outLen Number of elements in out (at least tapCount - 1)
+ * \return FirStatus Error code indicating success or describing failure
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define fir_flush(f, out, outLen) _Generic((f), \
+    FIR_TYPE_TABLE(fir_flush) \
+)(f, out, outLen)
+
+/*!
+ * \brief Forget the input history so the next block starts a new stream
+ * 
+ * \param f Pointer to the filter
+ * \return FirStatus Error code indicating success or describing failure
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define fir_reset(f) _Generic((f), \
+    FIR_TYPE_TABLE(fir_reset) \
+)(f)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FIR_H
@@ -0,0 +1,107 @@
+/*!
+ * \file hash.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Checksums and non-cryptographic hashes of byte buffers.
+ * \remarks Two functions, each usable one-shot or over data arriving in pieces:
+ * - CRC32C (Castagnoli, as used by iSCSI, ext4 and many record formats) for integrity checks.
+ *   It uses the SSE4.2 crc32 instruction when the CPU has it, running three streams at once over
+ *   large buffers and joining them with carry-less multiplication (PCLMULQDQ); other CPUs use
+ *   slicing-by-8 tables. Checksums of separately processed pieces join with \ref crc32c_combine.
+ * - XXH64 for hash tables and fingerprints. Results are bit-identical to the reference xxHash
+ *   implementation (and so to other tools using it), on hosts of either byte order.
+ *
+ * Neither is suitable where an adversary chooses the input; use a keyed cryptographic hash there.
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * \brief Computes or continues a CRC32C checksum.
+ * \remarks Start with crc = 0 and pass each result back in to continue over the next piece:
+ * crc32c(crc32c(0, a, n), b, m) equals the checksum of a followed by b.
+ * The check value of the ASCII string "123456789" is 0xE3069283.
+ *
+ * \param crc Checksum of the preceding data, or 0 to start
+ * \param data Bytes to add; needs no particular alignment
+ * \param len Number of bytes
+ * \return uint32_t Checksum of the preceding data followed by data
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+uint32_t crc32c(uint32_t crc, const void *data, size_t len);
+
+/*!
+ * \brief Joins the checksums of two adjacent pieces into the checksum of both.
+ * \remarks Lets the pieces of a buffer be checksummed in parallel (or cached separately) and
+ * combined afterwards. Costs O(log lenB) multiplications modulo the CRC polynomial, independent of the data.
+ *
+ * \param crcA Checksum of the first piece
+ * \param crcB Checksum of the second piece, started from 0
+ * \param lenB Length of the second piece in bytes
+ * \return uint32_t Checksum of the first piece followed by the second
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+uint32_t crc32c_combine(uint32_t crcA, uint32_t crcB, size_t lenB);
+
+/*!
+ * \brief Computes the XXH64 hash of a buffer.
+ *
+ * \param data Bytes to hash; needs no particular alignment
+ * \param len Number of bytes
+ * \param seed Seed selecting one of 2^64 unrelated hash functions; 0 is the common default
+ * \return uint64_t The hash
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+uint64_t hash64(const void *data, size_t len, uint64_t seed);
+
+/*! State of a streaming XXH64 hash */
+typedef struct {
+    uint64_t lanes[4]; //!< accumulators, one per 8-byte column of the 32-byte stripes
+    uint64_t total; //!< bytes hashed so far
+    uint64_t seed; //!< seed given to \ref hash64_init
+    uint8_t buffer[32]; //!< start of a stripe not yet complete
+    uint32_t buffered; //!< number of bytes in buffer
+} Hash64State;
+
+/*!
+ * \brief Streaming XXH64.
+ * \remarks Feeding a buffer in pieces of any size through hash64_update gives the same digest as
+ * \ref hash64 over the whole. hash64_digest does not change the state, so hashing can continue
+ * after it, e.g. to fingerprint every prefix of a log.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+void hash64_init(Hash64State *state, uint64_t seed);
+void hash64_update(Hash64State *state, const void *data, size_t len);
+uint64_t hash64_digest(const Hash64State *state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HASH_H
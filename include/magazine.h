@@ -0,0 +1,135 @@
+/*!
+ * \file magazine.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Per-thread magazine caches in front of a shared AtomicMemoryPool.
+ * \remarks Bonwick's magazine layer: each thread allocates from and frees to its own
+ * \ref MagazineCache, a pair of small stacks of blocks (magazines), without touching shared memory.
+ * Only when both are exhausted (or both full) does the cache trade a whole magazine with the shared
+ * \ref MagazineDepot, or move half a magazine of blocks to or from the pool, so shared cache lines
+ * are touched once per MAGAZINE_CAPACITY / 2 operations or less instead of on every one.
+ *
+ * Everything stays lock-free and allocation-free: the depot keeps its full and empty magazines in
+ * two \ref AtomicMemoryPool stacks over a caller-provided array of \ref Magazine.
+ *
+ * Blocks cached by one thread are not available to the others until that thread drains its cache,
+ * so size the pool for roughly 2 * MAGAZINE_CAPACITY blocks per thread beyond the working set.
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef MAGAZINE_H
+#define MAGAZINE_H
+
+#include "mempool.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef MAGAZINE_CAPACITY
+#define MAGAZINE_CAPACITY 32 //!< blocks per magazine; the library and its users must agree on it
+#endif
+
+/*! A stack of up to MAGAZINE_CAPACITY blocks */
+typedef struct {
+    void *link; //!< reserved for the depot's stacks while no cache holds the magazine
+    size_t count; //!< number of blocks in use
+    void *blocks[MAGAZINE_CAPACITY]; //!< the blocks, most recently freed last
+} Magazine;
+
+/*! Shared exchange of full and empty magazines */
+typedef struct {
+    AtomicMemoryPool *pool; //!< where blocks come from and go back to
+    AtomicMemoryPool full; //!< magazines holding MAGAZINE_CAPACITY blocks
+    AtomicMemoryPool empty; //!< magazines holding none
+} MagazineDepot;
+
+/*! One thread's cache; use it only from the thread that initialized it */
+typedef struct MagazineCache {
+    MagazineDepot *depot; //!< depot the cache trades with
+    Magazine *loaded; //!< magazine allocations and frees work on
+    Magazine *previous; //!< spare magazine, swapped in before going to the depot
+    struct MagazineCache *nextInThread; //!< next cache registered by the same thread, for draining at exit
+} MagazineCache;
+
+/*!
+ * \brief Initializes a depot over an initialized pool and an array of magazines.
+ * \remarks Every cache takes two magazines; the rest circulate through the depot, so
+ * 3 * threads is a good count. Not itself thread-safe: finish before sharing the depot.
+ *
+ * \param depot Pointer to the depot
+ * \param pool Shared pool the blocks come from; must outlive the depot
+ * \param magazines Storage for the magazines; must outlive the depot
+ * \param magazineCount Number of elements in magazines
+ * \return bool Whether the parameters were valid
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+bool md_init(MagazineDepot *depot, AtomicMemoryPool *pool, Magazine magazines[], size_t magazineCount);
+
+/*!
+ * \brief Initializes the calling thread's cache and registers it to be drained when the thread exits.
+ * \remarks The cache must stay valid until it is drained. If the depot has no magazines left, the
+ * cache still works but passes every call straight through to the pool, and false is returned.
+ * Draining at exit needs C11 threads; threads started by any other means should call \ref mc_drain.
+ * Calling it again on a cache this thread already initialized drains the cache first.
+ *
+ * \param cache Pointer to the cache
+ * \param depot Depot to trade with
+ * \return bool Whether the cache got its magazines
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+bool mc_init(MagazineCache *cache, MagazineDepot *depot);
+
+/*!
+ * \brief Gives all of the cache's blocks and magazines back and unregisters it.
+ * \remarks Full magazines go to the depot for other threads; blocks in partly filled ones go back
+ * to the pool. Call from the owning thread, e.g. before it exits or when it goes idle; the cache
+ * passes calls through to the pool afterwards until \ref mc_init is called again.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+void mc_drain(MagazineCache *cache);
+
+/*! \brief Out-of-line halves of \ref mc_alloc and \ref mc_free, for when the loaded magazine is empty or full. */
+void *mc_allocSlow(MagazineCache *cache);
+void mc_freeSlow(MagazineCache *cache, void *ptr);
+
+/*! \brief Takes a block; NULL if the pool is exhausted. The common case is a pop from the loaded magazine. */
+static inline void *mc_alloc(MagazineCache *cache) {
+    Magazine *m = cache->loaded;
+    if (m && m->count > 0) {
+        return m->blocks[--m->count];
+    }
+    return mc_allocSlow(cache);
+}
+
+/*! \brief Returns a block from the depot's pool. The common case is a push onto the loaded magazine. */
+static inline void mc_free(MagazineCache *cache, void *ptr) {
+    Magazine *m = cache->loaded;
+    if (m && m->count < MAGAZINE_CAPACITY && ptr) {
+        m->blocks[m->count++] = ptr;
+        return;
+    }
+    mc_freeSlow(cache, ptr);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MAGAZINE_H
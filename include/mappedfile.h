@@ -0,0 +1,196 @@
+/*!
+ * \file mappedfile.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Read-only memory-mapped views of files as typed arrays.
+ * \remarks A view maps a whole file and presents the bytes from a given offset as an array of
+ * fixed-size elements stored in a given byte order, so a multi-gigabyte file of samples can be
+ * processed in place, without reading it in first. Pages are faulted in by the kernel on first touch.
+ *
+ * Element access decodes straight from the mapping and swaps on the fly when the file's byte order
+ * differs from the host's; the per-type getters compile to a load plus an optional byte swap, like
+ * the Unchecked accessors of binaryio.h. Bulk copies swap while copying with the vectorized
+ * \ref BitConverter_ReverseArray, so a range crosses memory once either way.
+ * When no swap is needed, \ref mv_data gives direct access to the mapped elements.
+ *
+ * Mapping needs POSIX mmap; on other platforms \ref mv_open returns \ref MAPPED_UNSUPPORTED.
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include "binaryio.h"
+#include "bitconverter.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! Error codes for mapped view functions */
+typedef enum {
+    MAPPED_SUCCESS = 0, //!< function completed normally
+    MAPPED_END, //!< function terminated because the range lies outside the view or file
+    MAPPED_IO, //!< function terminated because the file could not be opened or mapped; see errno
+    MAPPED_INVALID, //!< function terminated due to invalid state or parameters
+    MAPPED_UNSUPPORTED //!< memory mapping is not available on this platform
+} MappedStatus;
+
+/*! Expected access pattern of a range, passed on to the kernel's read-ahead */
+typedef enum {
+    MAPPED_ADVICE_NORMAL = 0, //!< default read-ahead
+    MAPPED_ADVICE_SEQUENTIAL, //!< the range is scanned once from front to back; read ahead aggressively
+    MAPPED_ADVICE_RANDOM, //!< the range is accessed in no particular order; do not read ahead
+    MAPPED_ADVICE_WILLNEED, //!< the range will be used soon; start reading it in now
+    MAPPED_ADVICE_DONTNEED //!< the range is not needed for now; its pages may be dropped
+} MappedAdvice;
+
+/*! Typed, read-only view of a mapped file */
+typedef struct {
+    const uint8_t *base; //!< Start of the mapping (page aligned), NULL for an empty file
+    size_t mapSize; //!< Length of the mapping in bytes
+    const uint8_t *data; //!< First element, base plus the offset given to \ref mv_open
+    size_t count; //!< Number of whole elements after the offset
+    size_t elementSize; //!< Size of one element in bytes
+    BinaryEndian endian; //!< Byte order of the elements in the file
+    bool swap; //!< Whether endian differs from the host's byte order
+} MappedView;
+
+/*!
+ * \brief Maps a file and views it as an array of elements.
+ * \remarks The file is mapped read-only and private, and its descriptor closed again; the view stays
+ * valid until \ref mv_close. Bytes after the last whole element are ignored. An empty file gives an
+ * empty view. The file must not be truncated while mapped, or touching the lost pages raises SIGBUS.
+ *
+ * \param v Pointer to the view to initialize
+ * \param path File to map
+ * \param offset Byte offset of the first element, e.g. to skip a header
+ * \param elementSize Size of one element: 1, 2, 4 or 8 bytes
+ * \param endian Byte order of the elements in the file
+ * \return MappedStatus \ref MAPPED_END if offset is past the end of the file,
+ * \ref MAPPED_IO with errno set if the file could not be opened, examined or mapped
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+MappedStatus mv_open(MappedView *v, const char *path, size_t offset, size_t elementSize, BinaryEndian endian);
+
+/*!
+ * \brief Unmaps the file and empties the view.
+ * \remarks Pointers obtained from \ref mv_data become invalid. Closing an empty view does nothing.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+MappedStatus mv_close(MappedView *v);
+
+/*!
+ * \brief Tells the kernel how a range of elements is about to be accessed.
+ * \remarks The range is widened to whole pages. Advice is only a hint; a kernel that ignores it
+ * still returns success. Typical use is \ref MAPPED_ADVICE_SEQUENTIAL before a full scan, and
+ * \ref MAPPED_ADVICE_DONTNEED behind it for files larger than memory.
+ *
+ * \param v Pointer to the view
+ * \param first Index of the first element of the range
+ * \param count Number of elements in the range
+ * \param advice Expected access pattern
+ * \return MappedStatus \ref MAPPED_END if the range exceeds the view, \ref MAPPED_IO if the kernel rejected it
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+MappedStatus mv_advise(const MappedView *v, size_t first, size_t count, MappedAdvice advice);
+
+/*!
+ * \brief Direct pointer to the mapped elements, for views that need no byte swap.
+ * \remarks Returns NULL when the elements have to be swapped (use the getters or copies instead).
+ * The pointer is only aligned to the element size if the offset given to \ref mv_open is.
+ */
+static inline const void *mv_data(const MappedView *v) {
+    return v->swap ? NULL : v->data;
+}
+
+/*! \brief Number of whole elements in the view. */
+static inline size_t mv_count(const MappedView *v) {
+    return v->count;
+}
+
+/*!
+ * \brief Initializes a binary reader over the view's elements, e.g. for files of mixed records.
+ * \remarks The reader uses the view's byte order and stays valid until \ref mv_close.
+ */
+static inline BinaryStatus mv_reader(const MappedView *v, BinaryReader *r) {
+    return br_init(r, v->data, v->count * v->elementSize, v->endian);
+}
+
+/*!
+ * \brief Macro for the per-element getters of one multi-byte type.
+ * \remarks Generates mv_get{NAME}(v, index), which decodes element index in the view's byte order.
+ * There is no bounds check; index must be below \ref mv_count and the view's element size must be sizeof(T).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define MAPPEDFILE_GET_DEFINE(NAME, T) \
+static inline T mv_get##NAME(const MappedView *v, size_t index) { \
+    const uint8_t *p = v->data + index * sizeof(T); \
+    return (v->endian == BINARY_BIG_ENDIAN) ? BitConverter_To##NAME##BE(p) : BitConverter_To##NAME##LE(p); \
+}
+
+    BINARYIO_TYPE_MAP(MAPPEDFILE_GET_DEFINE)
+
+#undef MAPPEDFILE_GET_DEFINE
+
+/*!
+ * \brief Macro for the bulk range copies of one type.
+ * \remarks mv_copy{NAME}(v, first, count, dest) materializes elements [first, first + count) in host
+ * byte order, swapping during the copy when needed. It returns \ref MAPPED_INVALID if the view's
+ * element size is not sizeof(T) and \ref MAPPED_END, copying nothing, if the range exceeds the view.
+ * Copying a large file in chunks that fit in cache keeps the destination hot for the code that uses it.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define MAPPEDFILE_COPY_DECLARE(NAME, T) \
+MappedStatus mv_copy##NAME(const MappedView *v, size_t first, size_t count, T dest[]);
+
+    MAPPEDFILE_COPY_DECLARE(Int8, int8_t)
+    MAPPEDFILE_COPY_DECLARE(UInt8, uint8_t)
+    BINARYIO_TYPE_MAP(MAPPEDFILE_COPY_DECLARE)
+
+#undef MAPPEDFILE_COPY_DECLARE
+
+/*! \brief Generic macro to copy count elements starting at first into a typed array. */
+#define mv_copy(v, first, count, dest) _Generic((dest), \
+    int8_t*: mv_copyInt8, \
+    uint8_t*: mv_copyUInt8, \
+    int16_t*: mv_copyInt16, \
+    uint16_t*: mv_copyUInt16, \
+    int32_t*: mv_copyInt32, \
+    uint32_t*: mv_copyUInt32, \
+    int64_t*: mv_copyInt64, \
+    uint64_t*: mv_copyUInt64, \
+    float*: mv_copyFloat, \
+    double*: mv_copyDouble \
+)(v, first, count, dest)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MAPPEDFILE_H
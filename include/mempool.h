@@ -3,6 +3,17 @@
  * \author William (116991920+wdg0008@users.noreply.github.com)
  * \brief Chunk-based homogeneous memory allocator using external buffer
  * \remarks Designed to be efficient and operate in O(1) time usually
+ *
+ * MemoryPool is for a single thread (or callers that lock around it). AtomicMemoryPool has the
+ * same contract but may be shared by any number of threads allocating and freeing at once.
+ *
+ * MemoryPool always keeps its live count and high-water mark; see \ref mp_stats. Two compile-time
+ * options (CMake: CMOR_MEMPOOL_STATS, CMOR_MEMPOOL_DEBUG) add more, and cost nothing when off:
+ * - MEMPOOL_STATS counts allocations, frees and failed allocations.
+ * - MEMPOOL_DEBUG implies MEMPOOL_STATS. It poisons freed blocks, checks the poison when a block
+ *   is reused, rejects pointers mp_free did not hand out and, with \ref mp_debugInit, double frees,
+ *   and lists live blocks with \ref mp_forEachLive.
+ * Both change the layout of MemoryPool, so the library and its users must agree on them.
  * \version 0.1
  * \date 2026-05-19
  * 
@@ -10,21 +21,69 @@
  * 
  */
 
+#ifndef MEMPOOL_H
+#define MEMPOOL_H
+
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
+#define MEMPOOL_ATOMIC(T) alignas(sizeof(T)) T // layout stand-in; only the C side touches these fields
 extern "C" {
+#else
+#include <stdatomic.h>
+#define MEMPOOL_ATOMIC(T) _Atomic(T)
+#endif
+
+#if defined(MEMPOOL_DEBUG) && !defined(MEMPOOL_STATS)
+#define MEMPOOL_STATS
 #endif
+
+#define MEMPOOL_POISON 0xDD //!< byte that MEMPOOL_DEBUG fills freed blocks with
+
+/*! Misuse detected by MEMPOOL_DEBUG */
+typedef enum {
+    MEMPOOL_FOREIGN_POINTER, //!< mp_free of a pointer that is not the start of a block handed out by the pool
+    MEMPOOL_DOUBLE_FREE, //!< mp_free of a block that is already free
+    MEMPOOL_USE_AFTER_FREE //!< a free block was written to before mp_alloc handed it out again
+} MemoryPoolError;
+
+struct MemoryPool;
+typedef void (*MemoryPoolErrorHandler)(const struct MemoryPool *pool, MemoryPoolError error, void *ptr);
  
-typedef struct {
+typedef struct MemoryPool {
     unsigned char *buf;
     size_t blockSize;
     size_t blockCount;
+    size_t carved; //!< blocks handed out at least once; the rest of buf has never been touched
+    size_t liveBlocks; //!< blocks handed out and not yet freed
     void *freeList;
     bool initialized;
+#ifdef MEMPOOL_STATS
+    uint64_t totalAllocs; //!< successful mp_alloc calls
+    uint64_t totalFrees; //!< accepted mp_free calls
+    uint64_t failedAllocs; //!< mp_alloc calls that found the pool empty
+#endif
+#ifdef MEMPOOL_DEBUG
+    uint64_t *occupancy; //!< one bit per block, set while it is live; NULL until \ref mp_debugInit
+    MemoryPoolErrorHandler onError; //!< called for each error found; may be NULL
+    uint64_t errors; //!< errors found
+#endif
 } MemoryPool;
 
+/*! Usage of a MemoryPool, from \ref mp_stats */
+typedef struct {
+    size_t capacity; //!< number of blocks
+    size_t live; //!< blocks handed out and not yet freed
+    size_t free; //!< blocks available
+    size_t highWater; //!< most blocks live at once; also how many blocks of the buffer have been touched
+    uint64_t allocs; //!< successful allocations (0 without MEMPOOL_STATS)
+    uint64_t frees; //!< frees (0 without MEMPOOL_STATS)
+    uint64_t failedAllocs; //!< allocations that found the pool empty (0 without MEMPOOL_STATS)
+    uint64_t errors; //!< misuse found (0 without MEMPOOL_DEBUG)
+} MemoryPoolStats;
+
 bool mp_init(
     MemoryPool *pool, 
     void *buf, 
@@ -42,6 +101,134 @@ size_t mp_openBlocks(const MemoryPool *pool);
 
 bool mp_isEmpty(const MemoryPool *pool);
 
+/*!
+ * \brief Reports how a pool is being used. O(1).
+ *
+ * \param pool Pointer to the pool
+ * \return MemoryPoolStats The counts; all zero if the pool is not initialized
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-17
+ * \copyright Copyright (c) 2026
+ */
+MemoryPoolStats mp_stats(const MemoryPool *pool);
+
+#define MEMPOOL_BITMAP_WORDS(blockCount) (((blockCount) + 63) / 64) //!< uint64_t words \ref mp_debugInit needs
+
+#ifdef MEMPOOL_DEBUG
+/*!
+ * \brief Turns on double-free detection and live-block listing for a pool.
+ * \remarks Call after mp_init and before the first mp_alloc. Pointers that are not blocks of the
+ * pool are caught without it. Each error found is counted, passed to onError and, for a bad free,
+ * otherwise ignored so the free list stays intact. Without MEMPOOL_DEBUG this does nothing and
+ * returns false.
+ *
+ * \param pool Pointer to the pool
+ * \param bitmap Occupancy bitmap of MEMPOOL_BITMAP_WORDS(blockCount) words; must outlive the pool
+ * \param bitmapWords Number of words in bitmap
+ * \param onError Called with each error found; may be NULL
+ * \return bool Whether tracking is on
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-17
+ * \copyright Copyright (c) 2026
+ */
+bool mp_debugInit(MemoryPool *pool, uint64_t *bitmap, size_t bitmapWords, MemoryPoolErrorHandler onError);
+
+/*!
+ * \brief Calls visit on every live block in address order, e.g. to report leaks at shutdown.
+ * \remarks Needs \ref mp_debugInit; without it, or without MEMPOOL_DEBUG, visits nothing.
+ * visit must not allocate from or free to the pool.
+ *
+ * \param pool Pointer to the pool
+ * \param visit Called with each live block and ctx
+ * \param ctx Passed through to visit
+ * \return size_t Number of blocks visited
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-17
+ * \copyright Copyright (c) 2026
+ */
+size_t mp_forEachLive(const MemoryPool *pool, void (*visit)(void *block, void *ctx), void *ctx);
+#else
+static inline bool mp_debugInit(MemoryPool *pool, uint64_t *bitmap, size_t bitmapWords, MemoryPoolErrorHandler onError) {
+    (void)pool;
+    (void)bitmap;
+    (void)bitmapWords;
+    (void)onError;
+    return false;
+}
+
+static inline size_t mp_forEachLive(const MemoryPool *pool, void (*visit)(void *block, void *ctx), void *ctx) {
+    (void)pool;
+    (void)visit;
+    (void)ctx;
+    return 0;
+}
+#endif
+
+/*!
+ * \brief Thread-safe pool of fixed-size blocks over an external buffer.
+ * \remarks The free list is a lock-free Treiber stack. Its head packs the index of the top block
+ * (plus one; 0 when empty) with a generation tag that every successful push or pop increments,
+ * so a compare-and-swap cannot succeed on a head that was popped and pushed back in between
+ * (the ABA problem). Links are block indices rather than pointers, so a thread that reads a link
+ * from a block another thread has just taken still reads inside the buffer, and its stale value
+ * is discarded when the tag check fails.
+ *
+ * The head fits in one 64-bit word, which is lock-free on every 64-bit target and on x86 via
+ * cmpxchg8b, so the pool is limited to UINT32_MAX - 1 blocks.
+ */
+typedef struct {
+    unsigned char *buf; //!< Start of the blocks
+    size_t blockSize; //!< Block size after rounding up for alignment
+    size_t blockCount; //!< Number of blocks
+    bool initialized; //!< Set by \ref amp_init
+    MEMPOOL_ATOMIC(uint64_t) head; //!< generation tag << 32 | (index of the top free block + 1)
+    MEMPOOL_ATOMIC(size_t) freeBlocks; //!< number of free blocks, for \ref amp_openBlocks
+} AtomicMemoryPool;
+
+/*!
+ * \brief Initializes a thread-safe pool over buf, like \ref mp_init.
+ * \remarks Not itself thread-safe: finish initialization before sharing the pool.
+ * Block sizes are rounded up to a multiple of pointer alignment, and bufSize must hold
+ * blockCount of the rounded blocks.
+ *
+ * \param pool Pointer to the pool
+ * \param buf Buffer holding the blocks, aligned for pointers; must outlive the pool
+ * \param bufSize Length of buf in bytes
+ * \param blockSize Requested block size, at least 4 bytes
+ * \param blockCount Number of blocks, at most UINT32_MAX - 1
+ * \param roundedBlockSize Receives the rounded block size (may be NULL)
+ * \return bool Whether the parameters were valid
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+bool amp_init(
+    AtomicMemoryPool *pool,
+    void *buf,
+    size_t bufSize,
+    size_t blockSize,
+    size_t blockCount,
+    size_t *roundedBlockSize
+);
+
+/*! \brief Takes a block from the pool; NULL if none are free. Safe to call from any thread. */
+void* amp_alloc(AtomicMemoryPool *pool);
+
+/*! \brief Returns a block obtained from \ref amp_alloc on the same pool. Safe to call from any thread. */
+void amp_free(AtomicMemoryPool *pool, void *ptr);
+
+/*! \brief Number of free blocks; a snapshot that other threads may change at any time. O(1). */
+size_t amp_openBlocks(const AtomicMemoryPool *pool);
+
+/*! \brief Whether no block is free; a snapshot like \ref amp_openBlocks. */
+bool amp_isEmpty(const AtomicMemoryPool *pool);
+
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
+
+#endif // MEMPOOL_H
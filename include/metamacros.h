@@ -88,6 +88,17 @@ extern "C" {
     FTYPE_MAP(FUNC, float), \
     FTYPE_MAP(FUNC, double)
 
+/*! \brief Integer-only form of \ref TYPE_TABLE, for functions generated with \ref STDINT_TYPE_MAP. */
+#define STDINT_TYPE_TABLE(FUNC) \
+    FTYPE_MAP(FUNC, int8_t), \
+    FTYPE_MAP(FUNC, int16_t), \
+    FTYPE_MAP(FUNC, int32_t), \
+    FTYPE_MAP(FUNC, int64_t), \
+    FTYPE_MAP(FUNC, uint8_t), \
+    FTYPE_MAP(FUNC, uint16_t), \
+    FTYPE_MAP(FUNC, uint32_t), \
+    FTYPE_MAP(FUNC, uint64_t)
+
 /*!
  * \brief Maps a function to a pointer of a supported type for _Generic usage.
  * 
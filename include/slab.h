@@ -0,0 +1,119 @@
+/*!
+ * \file slab.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief General-purpose allocator built from size classes of MemoryPools.
+ * \remarks Requests up to SLAB_MAX_SMALL bytes are rounded up to one of SLAB_CLASS_COUNT size
+ * classes (16-byte steps to 128, then four per power of two). Each class is a list of chunks:
+ * 1 MiB mappings (SLAB_CHUNK_SIZE in slab.c) aligned to their own size, holding a small header
+ * and a \ref MemoryPool over the rest. Masking a pointer with the chunk size therefore finds its
+ * header, and with it the size class, in O(1), and blocks of one size never interleave with
+ * blocks of another, so freeing cannot fragment the heap the way it does with malloc.
+ *
+ * Chunks are carved lazily (see \ref mp_init), so a new chunk costs one mmap and only pages that
+ * blocks have actually used become resident. A chunk whose last block is freed goes back to the
+ * OS unless it is the class's only chunk with room; \ref slab_trim releases those too.
+ * Larger requests get a mapping of their own, returned by \ref slab_free.
+ *
+ * Not thread-safe: use one allocator per thread or lock around it. Needs POSIX mmap; elsewhere
+ * \ref slab_init returns false.
+ *
+ * \version 0.1
+ * \date 2026-10-17
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SLAB_H
+#define SLAB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SLAB_MAX_SMALL 16384 //!< largest request served from a size class
+#define SLAB_CLASS_COUNT 36 //!< number of size classes up to SLAB_MAX_SMALL
+
+typedef struct SlabChunk SlabChunk;
+
+/*! Set of size classes; zero-initialize with \ref slab_init */
+typedef struct {
+    SlabChunk *partial[SLAB_CLASS_COUNT]; //!< per class, chunks with at least one free block
+    SlabChunk *full; //!< chunks of any class with no free blocks
+    SlabChunk *large; //!< mappings holding one allocation larger than SLAB_MAX_SMALL
+    size_t mappedBytes; //!< bytes currently mapped from the OS
+    bool initialized; //!< Set by \ref slab_init
+} SlabAllocator;
+
+/*!
+ * \brief Initializes an empty allocator; maps nothing until the first allocation.
+ *
+ * \param slab Pointer to the allocator
+ * \return bool Whether the platform supports it
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-17
+ * \copyright Copyright (c) 2026
+ */
+bool slab_init(SlabAllocator *slab);
+
+/*!
+ * \brief Returns every chunk to the OS, including blocks still allocated.
+ *
+ * \param slab Pointer to the allocator
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-17
+ * \copyright Copyright (c) 2026
+ */
+void slab_destroy(SlabAllocator *slab);
+
+/*!
+ * \brief Allocates size bytes, like malloc, aligned for any object type.
+ *
+ * \param slab Pointer to the allocator
+ * \param size Bytes needed; 0 gets a minimum-sized block
+ * \return void* The memory, or NULL if the OS refused more
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-17
+ * \copyright Copyright (c) 2026
+ */
+void *slab_alloc(SlabAllocator *slab, size_t size);
+
+/*! \brief Like calloc: count * size zeroed bytes, or NULL on overflow or exhaustion. */
+void *slab_calloc(SlabAllocator *slab, size_t count, size_t size);
+
+/*!
+ * \brief Like realloc: resizes ptr, moving it if its size class changes.
+ * \remarks A NULL ptr allocates; a size of 0 frees ptr and returns NULL. If the new block cannot
+ * be had, returns NULL and leaves ptr allocated and unchanged.
+ *
+ * \param slab Pointer to the allocator that returned ptr
+ * \param ptr Memory to resize, or NULL
+ * \param size New size in bytes
+ * \return void* The resized memory
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-17
+ * \copyright Copyright (c) 2026
+ */
+void *slab_realloc(SlabAllocator *slab, void *ptr, size_t size);
+
+/*! \brief Like free: ptr must come from this allocator, or be NULL. */
+void slab_free(SlabAllocator *slab, void *ptr);
+
+/*! \brief Bytes usable at ptr, at least what was asked for; 0 for NULL. O(1). */
+size_t slab_usableSize(const void *ptr);
+
+/*! \brief Returns every chunk with no blocks in use to the OS. */
+void slab_trim(SlabAllocator *slab);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SLAB_H
@@ -0,0 +1,208 @@
+/*!
+ * \file textcodec.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Hex and Base64 (RFC 4648) text encodings for byte buffers.
+ * \remarks Encoders write exactly the encoded text, without a terminating NUL.
+ * Decoders are strict: any character outside the alphabet (whitespace included), misplaced or
+ * missing padding, a truncated final group, or nonzero unused bits in the final group is rejected
+ * with \ref TEXTCODEC_MALFORMED, so every accepted text has exactly one encoding.
+ *
+ * The bulk of each buffer is converted with AVX2 kernels when the CPU has them (32 to 64 characters
+ * per step); the ends of buffers and older CPUs use table-driven scalar code.
+ *
+ * The streaming encoder and decoders accept input in chunks of any size, carrying a partial group
+ * between calls, and produce output identical to a single call over the concatenated input.
+ * Hex encoding has no state, so chunks can simply be passed to \ref hex_encode one after another.
+ * A successful Final call resets the state, so the object can be reused for another stream.
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef TEXTCODEC_H
+#define TEXTCODEC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! Error codes for text codec functions */
+typedef enum {
+    TEXTCODEC_SUCCESS = 0, //!< function completed normally
+    TEXTCODEC_END, //!< function terminated because the output buffer is too small; nothing was written
+    TEXTCODEC_MALFORMED, //!< function terminated because the input is not valid encoded text
+    TEXTCODEC_INVALID //!< function terminated due to invalid parameters
+} TextCodecStatus;
+
+/*! Base64 alphabets */
+typedef enum {
+    BASE64_STANDARD = 0, //!< A-Z a-z 0-9 + / with '=' padding, which the decoder requires
+    BASE64_URL //!< A-Z a-z 0-9 - _ without padding; the decoder also accepts correctly padded input
+} Base64Variant;
+
+/*! \brief Number of characters \ref hex_encode writes for the given number of bytes. */
+static inline size_t hex_encodedSize(size_t bytes) {
+    return 2 * bytes;
+}
+
+/*! \brief Number of characters \ref base64_encode writes for the given number of bytes. */
+static inline size_t base64_encodedSize(size_t bytes, Base64Variant variant) {
+    return variant == BASE64_URL ? bytes / 3 * 4 + (bytes % 3 ? bytes % 3 + 1 : 0) : (bytes + 2) / 3 * 4;
+}
+
+/*!
+ * \brief Encodes bytes as hexadecimal text, two digits per byte.
+ *
+ * \param src Bytes to encode.
+ * \param len Number of bytes.
+ * \param out Buffer receiving \ref hex_encodedSize(len) characters.
+ * \param outSize Size of out in characters.
+ * \param upper Use A-F instead of a-f.
+ * \param written Receives the number of characters written (may be NULL).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+TextCodecStatus hex_encode(const uint8_t src[], size_t len, char out[], size_t outSize, bool upper, size_t *written);
+
+/*!
+ * \brief Decodes hexadecimal text (either case) to bytes.
+ * \remarks len must be even. On \ref TEXTCODEC_MALFORMED the contents of out are unspecified.
+ *
+ * \param in Text to decode.
+ * \param len Number of characters.
+ * \param out Buffer receiving len / 2 bytes.
+ * \param outSize Size of out in bytes.
+ * \param written Receives the number of bytes written (may be NULL).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+TextCodecStatus hex_decode(const char in[], size_t len, uint8_t out[], size_t outSize, size_t *written);
+
+/*!
+ * \brief Encodes bytes as Base64 text.
+ *
+ * \param src Bytes to encode.
+ * \param len Number of bytes.
+ * \param variant Alphabet and padding, see \ref Base64Variant.
+ * \param out Buffer receiving \ref base64_encodedSize characters.
+ * \param outSize Size of out in characters.
+ * \param written Receives the number of characters written (may be NULL).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+TextCodecStatus base64_encode(const uint8_t src[], size_t len, Base64Variant variant,
+                              char out[], size_t outSize, size_t *written);
+
+/*!
+ * \brief Number of bytes a valid Base64 text decodes to, taking its padding into account.
+ * \remarks For malformed text the result is only an estimate; \ref base64_decode reports the error.
+ */
+size_t base64_decodedSize(const char in[], size_t len);
+
+/*!
+ * \brief Decodes Base64 text to bytes.
+ * \remarks On \ref TEXTCODEC_MALFORMED the contents of out are unspecified.
+ *
+ * \param in Text to decode.
+ * \param len Number of characters.
+ * \param variant Alphabet and padding rules, see \ref Base64Variant.
+ * \param out Buffer receiving \ref base64_decodedSize bytes.
+ * \param outSize Size of out in bytes.
+ * \param written Receives the number of bytes written (may be NULL).
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+TextCodecStatus base64_decode(const char in[], size_t len, Base64Variant variant,
+                              uint8_t out[], size_t outSize, size_t *written);
+
+/*! State of a streaming hex decoder; a chunk may end between the two digits of a byte. */
+typedef struct {
+    char pending; //!< first digit of a split byte
+    bool hasPending; //!< whether pending is in use
+} HexDecoder;
+
+/*! State of a streaming Base64 encoder */
+typedef struct {
+    uint8_t pending[2]; //!< bytes not yet forming a full group of three
+    uint8_t count; //!< number of bytes in pending
+    Base64Variant variant; //!< alphabet and padding
+} Base64Encoder;
+
+/*! State of a streaming Base64 decoder */
+typedef struct {
+    char pending[3]; //!< characters not yet forming a full group of four
+    uint8_t count; //!< number of characters in pending
+    bool finished; //!< a padded group was seen; no further text is allowed
+    Base64Variant variant; //!< alphabet and padding rules
+} Base64Decoder;
+
+/*!
+ * \brief Streaming hex decoding.
+ * \remarks hex_decoderUpdate needs room for (len + 1) / 2 bytes; on any error the decoder state is
+ * left unchanged. hex_decoderFinal reports \ref TEXTCODEC_MALFORMED if a byte was left half finished.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+void hex_decoderInit(HexDecoder *decoder);
+TextCodecStatus hex_decoderUpdate(HexDecoder *decoder, const char in[], size_t len,
+                                  uint8_t out[], size_t outSize, size_t *written);
+TextCodecStatus hex_decoderFinal(HexDecoder *decoder);
+
+/*!
+ * \brief Streaming Base64 encoding.
+ * \remarks base64_encoderUpdate needs room for (len + 2) / 3 * 4 characters and base64_encoderFinal
+ * for 4; on \ref TEXTCODEC_END the encoder state is left unchanged, so the call can be retried.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+void base64_encoderInit(Base64Encoder *encoder, Base64Variant variant);
+TextCodecStatus base64_encoderUpdate(Base64Encoder *encoder, const uint8_t src[], size_t len,
+                                     char out[], size_t outSize, size_t *written);
+TextCodecStatus base64_encoderFinal(Base64Encoder *encoder, char out[], size_t outSize, size_t *written);
+
+/*!
+ * \brief Streaming Base64 decoding.
+ * \remarks base64_decoderUpdate needs room for (len + 3) / 4 * 3 bytes and base64_decoderFinal for 2;
+ * on any error the decoder state is left unchanged. base64_decoderFinal reports
+ * \ref TEXTCODEC_MALFORMED if the text ended in the middle of a group that padding should have closed.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+void base64_decoderInit(Base64Decoder *decoder, Base64Variant variant);
+TextCodecStatus base64_decoderUpdate(Base64Decoder *decoder, const char in[], size_t len,
+                                     uint8_t out[], size_t outSize, size_t *written);
+TextCodecStatus base64_decoderFinal(Base64Decoder *decoder, uint8_t out[], size_t outSize, size_t *written);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEXTCODEC_H
@@ -0,0 +1,150 @@
+/*!
+ * \file varint.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Variable-length integer (LEB128) and zigzag codecs.
+ * \remarks Unsigned values are written 7 bits per byte, least significant group first,
+ * with the high bit of each byte set when another byte follows (the protobuf / DWARF ULEB128 format).
+ * Signed values are zigzag-mapped first so small magnitudes of either sign stay short.
+ *
+ * The array decoders are vectorized: on CPUs with SSSE3 they decode four values per shuffle
+ * (sixteen when a run of values fits in one byte each), falling back to the scalar decoder
+ * for long encodings and the end of the input.
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef VARINT_H
+#define VARINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VARINT_MAX_BYTES_32 5 //!< longest encoding of a 32-bit value
+#define VARINT_MAX_BYTES_64 10 //!< longest encoding of a 64-bit value
+
+/*! Error codes for varint functions */
+typedef enum {
+    VARINT_SUCCESS = 0, //!< function completed normally
+    VARINT_END, //!< function terminated because the input ended mid-value or the output buffer filled up
+    VARINT_OVERFLOW, //!< function terminated because an encoded value does not fit the target type
+    VARINT_INVALID //!< function terminated due to invalid parameters
+} VarintStatus;
+
+/*! \brief Maps a signed value to unsigned so that small magnitudes map to small values (0, -1, 1, -2 -> 0, 1, 2, 3). */
+static inline uint32_t varint_zigzag32(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)-(int32_t)((uint32_t)value >> 31);
+}
+
+/*! \brief Maps a signed value to unsigned so that small magnitudes map to small values (0, -1, 1, -2 -> 0, 1, 2, 3). */
+static inline uint64_t varint_zigzag64(int64_t value) {
+    return ((uint64_t)value << 1) ^ (uint64_t)-(int64_t)((uint64_t)value >> 63);
+}
+
+/*! \brief Inverse of \ref varint_zigzag32. */
+static inline int32_t varint_unzigzag32(uint32_t value) {
+    return (int32_t)((value >> 1) ^ (uint32_t)-(int32_t)(value & 1));
+}
+
+/*! \brief Inverse of \ref varint_zigzag64. */
+static inline int64_t varint_unzigzag64(uint64_t value) {
+    return (int64_t)((value >> 1) ^ (uint64_t)-(int64_t)(value & 1));
+}
+
+/*!
+ * \brief Macro for the single-value varint function declarations.
+ * \remarks varint_size{NAME} returns the encoded length of a value.
+ * varint_encode{NAME} writes it to out, which must have room for the maximum length, and returns the bytes written.
+ * varint_decode{NAME} reads one value from at most inSize bytes and reports how many it consumed.
+ * The Int variants zigzag-map the value.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define VARINT_DECLARE(NAME, T) \
+size_t varint_size##NAME(T value); \
+size_t varint_encode##NAME(T value, uint8_t out[]); \
+VarintStatus varint_decode##NAME(const uint8_t in[], size_t inSize, T *value, size_t *consumed);
+
+/*!
+ * \brief Macro for the array varint function declarations.
+ * \remarks varint_encodeArray{NAME} encodes count values back to back and reports the bytes written;
+ * it stops with \ref VARINT_END, writing nothing more, once the next value would not fit.
+ * varint_decodeArray{NAME} decodes exactly count values and reports the bytes consumed;
+ * if it fails, *consumed marks where decoding stopped and the contents of dst are unspecified.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define VARINT_ARRAY_DECLARE(NAME, T) \
+VarintStatus varint_encodeArray##NAME(const T src[], size_t count, uint8_t out[], size_t outSize, size_t *written); \
+VarintStatus varint_decodeArray##NAME(const uint8_t in[], size_t inSize, T dst[], size_t count, size_t *consumed);
+
+/*! Types with varint codecs, with the names used in the function suffixes */
+#define VARINT_TYPE_MAP(FMACRO) \
+    FMACRO(UInt32, uint32_t) \
+    FMACRO(UInt64, uint64_t) \
+    FMACRO(Int32, int32_t) \
+    FMACRO(Int64, int64_t)
+
+    VARINT_TYPE_MAP(VARINT_DECLARE)
+    VARINT_TYPE_MAP(VARINT_ARRAY_DECLARE)
+
+#undef VARINT_DECLARE
+#undef VARINT_ARRAY_DECLARE
+
+/*!
+ * \brief Generic macro to encode one value, dispatching on its type.
+ * \remarks Signed types are zigzag-encoded. Returns the number of bytes written.
+ */
+#define varint_encode(value, out) _Generic((value), \
+    uint32_t: varint_encodeUInt32, \
+    uint64_t: varint_encodeUInt64, \
+    int32_t: varint_encodeInt32, \
+    int64_t: varint_encodeInt64 \
+)(value, out)
+
+/*! \brief Generic macro to decode one value into *value, dispatching on its pointer type. */
+#define varint_decode(in, inSize, value, consumed) _Generic((value), \
+    uint32_t*: varint_decodeUInt32, \
+    uint64_t*: varint_decodeUInt64, \
+    int32_t*: varint_decodeInt32, \
+    int64_t*: varint_decodeInt64 \
+)(in, inSize, value, consumed)
+
+/*! \brief Generic macro to encode an array, dispatching on the element type. */
+#define varint_encodeArray(src, count, out, outSize, written) _Generic((src), \
+    uint32_t*: varint_encodeArrayUInt32, \
+    uint64_t*: varint_encodeArrayUInt64, \
+    int32_t*: varint_encodeArrayInt32, \
+    int64_t*: varint_encodeArrayInt64, \
+    const uint32_t*: varint_encodeArrayUInt32, \
+    const uint64_t*: varint_encodeArrayUInt64, \
+    const int32_t*: varint_encodeArrayInt32, \
+    const int64_t*: varint_encodeArrayInt64 \
+)(src, count, out, outSize, written)
+
+/*! \brief Generic macro to decode an array, dispatching on the element type. */
+#define varint_decodeArray(in, inSize, dst, count, consumed) _Generic((dst), \
+    uint32_t*: varint_decodeArrayUInt32, \
+    uint64_t*: varint_decodeArrayUInt64, \
+    int32_t*: varint_decodeArrayInt32, \
+    int64_t*: varint_decodeArrayInt64 \
+)(in, inSize, dst, count, consumed)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VARINT_H
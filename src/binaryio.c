@@ -0,0 +1,171 @@
+/*!
+ * \file binaryio.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Provides function implementations for the binary readers and writers.
+ * \version 0.1
+ * \date 2026-10-16
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+
+#include "binaryio.h"
+
+BinaryStatus br_init(BinaryReader *r, const void *buf, size_t size, BinaryEndian endian) {
+    if (r == NULL || (buf == NULL && size > 0) ||
+        (endian != BINARY_LITTLE_ENDIAN && endian != BINARY_BIG_ENDIAN)) {
+        return BINARY_INVALID;
+    }
+    r->data = buf;
+    r->size = size;
+    r->pos = 0;
+    r->endian = endian;
+    return BINARY_SUCCESS;
+}
+
+BinaryStatus bw_init(BinaryWriter *w, void *buf, size_t size, BinaryEndian endian) {
+    if (w == NULL || (buf == NULL && size > 0) ||
+        (endian != BINARY_LITTLE_ENDIAN && endian != BINARY_BIG_ENDIAN)) {
+        return BINARY_INVALID;
+    }
+    w->data = buf;
+    w->size = size;
+    w->pos = 0;
+    w->endian = endian;
+    return BINARY_SUCCESS;
+}
+
+BinaryStatus br_seek(BinaryReader *r, size_t pos) {
+    if (r == NULL) {
+        return BINARY_INVALID;
+    }
+    if (pos > r->size) {
+        return BINARY_END;
+    }
+    r->pos = pos;
+    return BINARY_SUCCESS;
+}
+
+BinaryStatus br_skip(BinaryReader *r, size_t bytes) {
+    if (r == NULL) {
+        return BINARY_INVALID;
+    }
+    if (!br_ensure(r, bytes)) {
+        return BINARY_END;
+    }
+    r->pos += bytes;
+    return BINARY_SUCCESS;
+}
+
+BinaryStatus bw_seek(BinaryWriter *w, size_t pos) {
+    if (w == NULL) {
+        return BINARY_INVALID;
+    }
+    if (pos > w->size) {
+        return BINARY_END;
+    }
+    w->pos = pos;
+    return BINARY_SUCCESS;
+}
+
+BinaryStatus bw_skip(BinaryWriter *w, size_t bytes) {
+    if (w == NULL) {
+        return BINARY_INVALID;
+    }
+    if (!bw_ensure(w, bytes)) {
+        return BINARY_END;
+    }
+    w->pos += bytes;
+    return BINARY_SUCCESS;
+}
+
+BinaryStatus br_readBytes(BinaryReader *r, void *dest, size_t bytes) {
+    if (r == NULL || (dest == NULL && bytes > 0)) {
+        return BINARY_INVALID;
+    }
+    if (!br_ensure(r, bytes)) {
+        return BINARY_END;
+    }
+    if (bytes > 0) {
+        memcpy(dest, r->data + r->pos, bytes);
+    }
+    r->pos += bytes;
+    return BINARY_SUCCESS;
+}
+
+BinaryStatus br_view(BinaryReader *r, size_t bytes, const uint8_t **view) {
+    if (r == NULL || view == NULL) {
+        return BINARY_INVALID;
+    }
+    if (!br_ensure(r, bytes)) {
+        return BINARY_END;
+    }
+    *view = r->data + r->pos;
+    r->pos += bytes;
+    return BINARY_SUCCESS;
+}
+
+BinaryStatus bw_writeBytes(BinaryWriter *w, const void *src, size_t bytes) {
+    if (w == NULL || (src == NULL && bytes > 0)) {
+        return BINARY_INVALID;
+    }
+    if (!bw_ensure(w, bytes)) {
+        return BINARY_END;
+    }
+    if (bytes > 0) {
+        memcpy(w->data + w->pos, src, bytes);
+    }
+    w->pos += bytes;
+    return BINARY_SUCCESS;
+}
+
+/*! \brief True when values in the given byte order must be swapped to or from host order. */
+static bool needs_swap(BinaryEndian endian) {
+    return (endian == BINARY_BIG_ENDIAN) == (bool)BITCONVERTER_HOST_LITTLE;
+}
+
+/*!
+ * \brief Macro for the bulk array readers and writers.
+ * \remarks Byte swapping happens during the copy, so the data crosses memory once whether or not
+ * the byte orders match.
+ */
+#define BINARYIO_ARRAY_DEFINE(NAME, T) \
+BinaryStatus br_readArray##NAME(BinaryReader *r, T dest[], size_t count) { \
+    if (r == NULL || (dest == NULL && count > 0)) { \
+        return BINARY_INVALID; \
+    } \
+    if (count > br_remaining(r) / sizeof(T)) { \
+        return BINARY_END; \
+    } \
+    size_t bytes = count * sizeof(T); \
+    if (sizeof(T) > 1 && needs_swap(r->endian)) { \
+        BitConverter_ReverseArray_Bytes(dest, r->data + r->pos, count, sizeof(T)); \
+    } else if (bytes > 0) { \
+        memcpy(dest, r->data + r->pos, bytes); \
+    } \
+    r->pos += bytes; \
+    return BINARY_SUCCESS; \
+} \
+\
+BinaryStatus bw_writeArray##NAME(BinaryWriter *w, const T src[], size_t count) { \
+    if (w == NULL || (src == NULL && count > 0)) { \
+        return BINARY_INVALID; \
+    } \
+    if (count > bw_remaining(w) / sizeof(T)) { \
+        return BINARY_END; \
+    } \
+    size_t bytes = count * sizeof(T); \
+    if (sizeof(T) > 1 && needs_swap(w->endian)) { \
+        BitConverter_ReverseArray_Bytes(w->data + w->pos, src, count, sizeof(T)); \
+    } else if (bytes > 0) { \
+        memcpy(w->data + w->pos, src, bytes); \
+    } \
+    w->pos += bytes; \
+    return BINARY_SUCCESS; \
+}
+
+    BINARYIO_ARRAY_DEFINE(Int8, int8_t)
+    BINARYIO_ARRAY_DEFINE(UInt8, uint8_t)
+    BINARYIO_TYPE_MAP(BINARYIO_ARRAY_DEFINE)
+
+#undef BINARYIO_ARRAY_DEFINE
@@ -1,17 +1,18 @@
 #include "../include/bitconverter.h"
+#include "bitops.h"
+#include "simd.h"
 #include <string.h> // For memcpy
 
+#ifdef CMOR_LITTLE_ENDIAN
+bool g_is_little_endian = CMOR_LITTLE_ENDIAN;
+#else
 bool g_is_little_endian = true; // == 1 if little-endian
+#endif
 
 void BitConverter_Init() {
-    const uint16_t test = 0x1;
-    g_is_little_endian = (*(uint8_t*)&test); // == 1 if little-endian
-}
-
-uint8_t BitConverter_Log2Int(uint64_t value) {
-    uint8_t log = 0;
-    while (value >>= 1) ++log;
-    return log;
+#ifndef CMOR_LITTLE_ENDIAN
+    g_is_little_endian = BitConverter_HostIsLittle();
+#endif
 }
 
 double BitConverter_DoubleFromUInt64(uint64_t value) {
@@ -38,227 +39,475 @@ uint32_t BitConverter_UInt32FromFloat(float value) {
     return result;
 }
 
-void BitConverter_GetBytes_Int16(int16_t value, uint8_t bytes[2]) {
-    if (g_is_little_endian) {
-        bytes[0] = (uint8_t)(value & 0xFF);
-        bytes[1] = (uint8_t)((value >> 8) & 0xFF);
+uint16_t BitConverter_HalfFromFloat(float value) {
+    const uint32_t bits = BitConverter_UInt32FromFloat(value);
+    const uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+    const uint32_t abs = bits & 0x7FFFFFFF;
+    if (abs > 0x7F800000) { // NaN: quiet it and keep the top of the payload
+        return (uint16_t)(sign | 0x7E00 | ((abs >> 13) & 0x3FF));
+    }
+    if (abs >= 0x477FF000) { // 65520 and up round to infinity
+        return (uint16_t)(sign | 0x7C00);
+    }
+    if (abs >= 0x38800000) { // normal half: rebias the exponent, round off 13 mantissa bits
+        const uint32_t rebiased = abs - 0x38000000;
+        return (uint16_t)(sign | ((rebiased + 0xFFF + ((rebiased >> 13) & 1)) >> 13));
+    }
+    // subnormal half: the value in units of 2^-24, rounded to nearest even
+    const unsigned shift = 126 - (abs >> 23);
+    if (shift > 24) {
+        return sign;
+    }
+    const uint32_t mantissa = (abs & 0x7FFFFF) | 0x800000;
+    const uint32_t rest = mantissa & ((UINT32_C(1) << shift) - 1);
+    const uint32_t halfway = UINT32_C(1) << (shift - 1);
+    uint32_t result = mantissa >> shift;
+    result += rest > halfway || (rest == halfway && (result & 1));
+    return (uint16_t)(sign | result);
+}
+
+float BitConverter_FloatFromHalf(uint16_t value) {
+    const uint32_t sign = (uint32_t)(value & 0x8000) << 16;
+    const uint32_t exponent = (value >> 10) & 0x1F;
+    const uint32_t mantissa = value & 0x3FF;
+    uint32_t bits;
+    if (exponent == 0x1F) { // infinity, or NaN quieted as the F16C conversion does
+        bits = sign | 0x7F800000 | (mantissa << 13) | (mantissa ? 0x400000 : 0);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa != 0) { // subnormal half, normal float
+        const unsigned top = BitConverter_Log2Int(mantissa);
+        bits = sign | ((top + 103) << 23) | ((mantissa << (23 - top)) & 0x7FFFFF);
     } else {
-        bytes[1] = (uint8_t)(value & 0xFF);
-        bytes[0] = (uint8_t)((value >> 8) & 0xFF);
+        bits = sign;
     }
+    return BitConverter_FloatFromUInt32(bits);
 }
 
-void BitConverter_GetBytes_UInt16(uint16_t value, uint8_t bytes[2]) {
-    if (g_is_little_endian) {
-        bytes[0] = (uint8_t)(value & 0xFF);
-        bytes[1] = (uint8_t)((value >> 8) & 0xFF);
-    } else {
-        bytes[1] = (uint8_t)(value & 0xFF);
-        bytes[0] = (uint8_t)((value >> 8) & 0xFF);
+uint16_t BitConverter_BFloat16FromFloat(float value) {
+    const uint32_t bits = BitConverter_UInt32FromFloat(value);
+    if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+        return (uint16_t)((bits >> 16) | 0x40);
     }
+    return (uint16_t)((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
 }
 
-void BitConverter_GetBytes_Int32(int32_t value, uint8_t bytes[4]) {
-    if (g_is_little_endian) {
-        for (int i = 0; i < 4; i++) {
-            bytes[i] = (uint8_t)((value >> (i * 8)) & 0xFF);
-        }
-    } else {
-        for (int i = 0; i < 4; i++) {
-            bytes[3 - i] = (uint8_t)((value >> (i * 8)) & 0xFF);
-        }
-    }
+float BitConverter_FloatFromBFloat16(uint16_t value) {
+    return BitConverter_FloatFromUInt32((uint32_t)value << 16);
 }
 
-void BitConverter_GetBytes_UInt32(uint32_t value, uint8_t bytes[4]) {
-    if (g_is_little_endian) {
-        for (int i = 0; i < 4; i++) {
-            bytes[i] = (uint8_t)((value >> (i * 8)) & 0xFF);
-        }
-    } else {
-        for (int i = 0; i < 4; i++) {
-            bytes[3 - i] = (uint8_t)((value >> (i * 8)) & 0xFF);
-        }
-    }
+// GetBytes and To* use the host byte order, so they reduce to the matching explicit-order accessor
+#define BITCONVERTER_HOST_ORDER_DEFINE(NAME, T) \
+void BitConverter_GetBytes_##NAME(T value, uint8_t bytes[sizeof(T)]) { \
+    if (BITCONVERTER_HOST_LITTLE) { \
+        BitConverter_Write##NAME##LE(value, bytes); \
+    } else { \
+        BitConverter_Write##NAME##BE(value, bytes); \
+    } \
+} \
+\
+T BitConverter_To##NAME(const uint8_t bytes[sizeof(T)]) { \
+    return BITCONVERTER_HOST_LITTLE ? BitConverter_To##NAME##LE(bytes) : BitConverter_To##NAME##BE(bytes); \
 }
 
-void BitConverter_GetBytes_Int64(int64_t value, uint8_t bytes[8]) {
-    if (g_is_little_endian) {
-        for (int i = 0; i < 8; i++) {
-            bytes[i] = (uint8_t)((value >> (i * 8)) & 0xFF);
-        }
-    } else {
-        for (int i = 0; i < 8; i++) {
-            bytes[7 - i] = (uint8_t)((value >> (i * 8)) & 0xFF);
-        }
+    BITCONVERTER_HOST_ORDER_DEFINE(Int16, int16_t)
+    BITCONVERTER_HOST_ORDER_DEFINE(UInt16, uint16_t)
+    BITCONVERTER_HOST_ORDER_DEFINE(Int32, int32_t)
+    BITCONVERTER_HOST_ORDER_DEFINE(UInt32, uint32_t)
+    BITCONVERTER_HOST_ORDER_DEFINE(Int64, int64_t)
+    BITCONVERTER_HOST_ORDER_DEFINE(UInt64, uint64_t)
+    BITCONVERTER_HOST_ORDER_DEFINE(Float, float)
+    BITCONVERTER_HOST_ORDER_DEFINE(Double, double)
+
+#undef BITCONVERTER_HOST_ORDER_DEFINE
+
+void BitConverter_Reverse_Bytes(uint8_t* bytes, size_t length) {
+    for (size_t i = 0; i < length / 2; i++) {
+        uint8_t temp = bytes[i];
+        bytes[i] = bytes[length - 1 - i];
+        bytes[length - 1 - i] = temp;
     }
 }
 
-void BitConverter_GetBytes_UInt64(uint64_t value, uint8_t bytes[8]) {
-    if (g_is_little_endian) {
-        for (int i = 0; i < 8; i++) {
-            bytes[i] = (uint8_t)((value >> (i * 8)) & 0xFF);
-        }
-    } else {
-        for (int i = 0; i < 8; i++) {
-            bytes[7 - i] = (uint8_t)((value >> (i * 8)) & 0xFF);
-        }
-    }
+int16_t BitConverter_Reverse_Int16(int16_t value) {
+    return (int16_t)BitConverter_Reverse_UInt16((uint16_t)value);
 }
 
-void BitConverter_GetBytes_Float(float value, uint8_t bytes[4]) {
+uint16_t BitConverter_Reverse_UInt16(uint16_t value) {
+    return BitConverter_Bswap16(value);
+}
+
+int32_t BitConverter_Reverse_Int32(int32_t value) {
+    return (int32_t)BitConverter_Reverse_UInt32((uint32_t)value);
+}
+
+uint32_t BitConverter_Reverse_UInt32(uint32_t value) {
+    return BitConverter_Bswap32(value);
+}
+
+int64_t BitConverter_Reverse_Int64(int64_t value) {
+    return (int64_t)BitConverter_Reverse_UInt64((uint64_t)value);
+}
+
+uint64_t BitConverter_Reverse_UInt64(uint64_t value) {
+    return BitConverter_Bswap64(value);
+}
+
+float BitConverter_Reverse_Float(float value) {
     uint32_t asInt;
     memcpy(&asInt, &value, sizeof(float));
-    BitConverter_GetBytes_UInt32(asInt, bytes);
+    asInt = BitConverter_Reverse_UInt32(asInt);
+    float result;
+    memcpy(&result, &asInt, sizeof(float));
+    return result;
 }
 
-void BitConverter_GetBytes_Double(double value, uint8_t bytes[8]) {
+double BitConverter_Reverse_Double(double value) {
     uint64_t asInt;
     memcpy(&asInt, &value, sizeof(double));
-    BitConverter_GetBytes_UInt64(asInt, bytes);
+    asInt = BitConverter_Reverse_UInt64(asInt);
+    double result;
+    memcpy(&result, &asInt, sizeof(double));
+    return result;
 }
 
-int16_t BitConverter_ToInt16(const uint8_t bytes[2]) {
-    if (g_is_little_endian) {
-        return (int16_t)(bytes[0] | (bytes[1] << 8));
-    } else {
-        return (int16_t)(bytes[1] | (bytes[0] << 8));
+/*!
+ * \brief Scalar byte swaps for the tails of the bulk conversions and for CPUs without SSSE3.
+ * \remarks Elements are moved with memcpy, so the arrays need no particular alignment.
+ */
+static void reverse_scalar_16(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        uint16_t v;
+        memcpy(&v, src + i * 2, 2);
+        v = BitConverter_Bswap16(v);
+        memcpy(dst + i * 2, &v, 2);
     }
 }
 
-uint16_t BitConverter_ToUInt16(const uint8_t bytes[2]) {
-    if (g_is_little_endian) {
-        return (uint16_t)(bytes[0] | (bytes[1] << 8));
-    } else {
-        return (uint16_t)(bytes[1] | (bytes[0] << 8));
+static void reverse_scalar_32(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t v;
+        memcpy(&v, src + i * 4, 4);
+        v = BitConverter_Bswap32(v);
+        memcpy(dst + i * 4, &v, 4);
     }
 }
 
-int32_t BitConverter_ToInt32(const uint8_t bytes[4]) {
-    int32_t result = 0;
-    if (g_is_little_endian) {
-        for (int i = 0; i < 4; i++) {
-            result |= ((int32_t)bytes[i] << (i * 8));
-        }
-    } else {
-        for (int i = 0; i < 4; i++) {
-            result |= ((int32_t)bytes[3 - i] << (i * 8));
-        }
+static void reverse_scalar_64(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t v;
+        memcpy(&v, src + i * 8, 8);
+        v = BitConverter_Bswap64(v);
+        memcpy(dst + i * 8, &v, 8);
     }
-    return result;
 }
 
-uint32_t BitConverter_ToUInt32(const uint8_t bytes[4]) {
-    uint32_t result = 0;
-    if (g_is_little_endian) {
-        for (int i = 0; i < 4; i++) {
-            result |= ((int32_t)bytes[i] << (i * 8));
-        }
-    } else {
-        for (int i = 0; i < 4; i++) {
-            result |= ((int32_t)bytes[3 - i] << (i * 8));
-        }
+#if CMOR_X86_SIMD
+/*! pshufb controls reversing each 2, 4 or 8 byte group of a 16 byte lane. */
+static const uint8_t reverse_shuffle[3][16] = {
+    { 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 },
+    { 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 },
+    { 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 }
+};
+
+/*!
+ * \brief Byte swaps whole vectors and returns how many bytes were handled.
+ * \remarks Four vectors are loaded before any is stored, so in-place conversion is safe,
+ * and the unrolling keeps enough loads in flight to saturate memory bandwidth.
+ */
+CMOR_TARGET("ssse3") static size_t reverse_ssse3(uint8_t *dst, const uint8_t *src, size_t bytes, const uint8_t control[16]) {
+    const __m128i mask = _mm_loadu_si128((const __m128i *)control);
+    size_t i = 0;
+    for (; i + 64 <= bytes; i += 64) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(src + i + 16));
+        __m128i c = _mm_loadu_si128((const __m128i *)(src + i + 32));
+        __m128i d = _mm_loadu_si128((const __m128i *)(src + i + 48));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi8(a, mask));
+        _mm_storeu_si128((__m128i *)(dst + i + 16), _mm_shuffle_epi8(b, mask));
+        _mm_storeu_si128((__m128i *)(dst + i + 32), _mm_shuffle_epi8(c, mask));
+        _mm_storeu_si128((__m128i *)(dst + i + 48), _mm_shuffle_epi8(d, mask));
     }
-    return result;
+    for (; i + 16 <= bytes; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi8(a, mask));
+    }
+    return i;
+}
+
+CMOR_TARGET("avx2") static size_t reverse_avx2(uint8_t *dst, const uint8_t *src, size_t bytes, const uint8_t control[16]) {
+    const __m256i mask = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)control));
+    size_t i = 0;
+    for (; i + 128 <= bytes; i += 128) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(src + i + 32));
+        __m256i c = _mm256_loadu_si256((const __m256i *)(src + i + 64));
+        __m256i d = _mm256_loadu_si256((const __m256i *)(src + i + 96));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_shuffle_epi8(a, mask));
+        _mm256_storeu_si256((__m256i *)(dst + i + 32), _mm256_shuffle_epi8(b, mask));
+        _mm256_storeu_si256((__m256i *)(dst + i + 64), _mm256_shuffle_epi8(c, mask));
+        _mm256_storeu_si256((__m256i *)(dst + i + 96), _mm256_shuffle_epi8(d, mask));
+    }
+    for (; i + 32 <= bytes; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_shuffle_epi8(a, mask));
+    }
+    return i;
+}
+#endif // CMOR_X86_SIMD
+
+/*!
+ * \brief Byte swaps count elements of 2 << shift bytes each, using the widest available kernel.
+ */
+static void reverse_array(void *dst, const void *src, size_t count, unsigned shift) {
+    static void (*const scalar[3])(uint8_t *, const uint8_t *, size_t) = {
+        reverse_scalar_16, reverse_scalar_32, reverse_scalar_64
+    };
+    uint8_t *d = dst;
+    const uint8_t *s = src;
+    size_t bytes = count << (shift + 1);
+    size_t done = 0;
+    if (!d || !s) {
+        return;
+    }
+#if CMOR_X86_SIMD
+    SimdLevel level = simd_level();
+    if (level >= SIMD_AVX2) {
+        done = reverse_avx2(d, s, bytes, reverse_shuffle[shift]);
+    } else if (level >= SIMD_SSSE3) {
+        done = reverse_ssse3(d, s, bytes, reverse_shuffle[shift]);
+    }
+#endif
+    scalar[shift](d + done, s + done, (bytes - done) >> (shift + 1));
 }
 
-int64_t BitConverter_ToInt64(const uint8_t bytes[8]) {
-    int64_t result = 0;
-    if (g_is_little_endian) {
-        for (int i = 0; i < 8; i++) {
-            result |= ((int32_t)bytes[i] << (i * 8));
-        }
-    } else {
-        for (int i = 0; i < 8; i++) {
-            result |= ((int32_t)bytes[7 - i] << (i * 8));
+void BitConverter_ReverseArray_Bytes(void *dst, const void *src, size_t count, size_t elementSize) {
+    switch (elementSize) {
+    case 1:
+        if (dst && src && dst != src) {
+            memmove(dst, src, count);
         }
+        break;
+    case 2:
+        reverse_array(dst, src, count, 0);
+        break;
+    case 4:
+        reverse_array(dst, src, count, 1);
+        break;
+    case 8:
+        reverse_array(dst, src, count, 2);
+        break;
+    default:
+        break;
     }
-    return result;
 }
 
-uint64_t BitConverter_ToUInt64(const uint8_t bytes[8]) {
-    uint64_t result = 0;
-    if (g_is_little_endian) {
-        for (int i = 0; i < 8; i++) {
-            result |= ((int32_t)bytes[i] << (i * 8));
-        }
-    } else {
-        for (int i = 0; i < 8; i++) {
-            result |= ((int32_t)bytes[7 - i] << (i * 8));
-        }
+void BitConverter_ReverseArray_Int16(int16_t dst[], const int16_t src[], size_t count) {
+    reverse_array(dst, src, count, 0);
+}
+
+void BitConverter_ReverseArray_UInt16(uint16_t dst[], const uint16_t src[], size_t count) {
+    reverse_array(dst, src, count, 0);
+}
+
+void BitConverter_ReverseArray_Int32(int32_t dst[], const int32_t src[], size_t count) {
+    reverse_array(dst, src, count, 1);
+}
+
+void BitConverter_ReverseArray_UInt32(uint32_t dst[], const uint32_t src[], size_t count) {
+    reverse_array(dst, src, count, 1);
+}
+
+void BitConverter_ReverseArray_Float(float dst[], const float src[], size_t count) {
+    reverse_array(dst, src, count, 1);
+}
+
+void BitConverter_ReverseArray_Int64(int64_t dst[], const int64_t src[], size_t count) {
+    reverse_array(dst, src, count, 2);
+}
+
+void BitConverter_ReverseArray_UInt64(uint64_t dst[], const uint64_t src[], size_t count) {
+    reverse_array(dst, src, count, 2);
+}
+
+void BitConverter_ReverseArray_Double(double dst[], const double src[], size_t count) {
+    reverse_array(dst, src, count, 2);
+}
+
+#if CMOR_X86_SIMD
+/*!
+ * \brief 16-bit float conversion kernels; each returns how many elements it handled.
+ * \remarks The half kernels use the hardware conversions with round-to-nearest-even fixed in the
+ * immediate (not taken from MXCSR). The bfloat16 kernels do the same integer rounding as
+ * \ref BitConverter_BFloat16FromFloat rather than using AVX512_BF16, whose conversion flushes
+ * subnormals and so would disagree with the scalar path.
+ */
+CMOR_TARGET("avx,f16c") static size_t half_from_float_f16c(uint16_t *dst, const float *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i a = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        __m128i b = _mm256_cvtps_ph(_mm256_loadu_ps(src + i + 8), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i *)(dst + i), a);
+        _mm_storeu_si128((__m128i *)(dst + i + 8), b);
     }
-    return result;
+    for (; i + 8 <= count; i += 8) {
+        _mm_storeu_si128((__m128i *)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+    return i;
 }
 
-float BitConverter_ToFloat(const uint8_t bytes[4]) {
-    uint32_t asInt = BitConverter_ToUInt32(bytes);
-    float value;
-    memcpy(&value, &asInt, sizeof(float));
-    return value;
+CMOR_TARGET("avx,f16c") static size_t float_from_half_f16c(float *dst, const uint16_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256 a = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src + i)));
+        __m256 b = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src + i + 8)));
+        _mm256_storeu_ps(dst + i, a);
+        _mm256_storeu_ps(dst + i + 8, b);
+    }
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src + i))));
+    }
+    return i;
 }
 
-double BitConverter_ToDouble(const uint8_t bytes[8]) {
-    uint64_t asInt = BitConverter_ToUInt64(bytes);
-    double value;
-    memcpy(&value, &asInt, sizeof(double));
-    return value;
+CMOR_TARGET("avx512f") static size_t half_from_float_avx512(uint16_t *dst, const float *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+    return i;
 }
 
-void BitConverter_Reverse_Bytes(uint8_t* bytes, size_t length) {
-    for (size_t i = 0; i < length / 2; i++) {
-        uint8_t temp = bytes[i];
-        bytes[i] = bytes[length - 1 - i];
-        bytes[length - 1 - i] = temp;
+CMOR_TARGET("avx512f") static size_t float_from_half_avx512(float *dst, const uint16_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)(src + i))));
     }
+    return i;
 }
 
-int16_t BitConverter_Reverse_Int16(int16_t value) {
-    return (int16_t)BitConverter_Reverse_UInt16((uint16_t)value);
+CMOR_TARGET("avx2") static inline __m256i bfloat16_round_avx2(__m256 value) {
+    const __m256i bits = _mm256_castps_si256(value);
+    const __m256i upper = _mm256_srli_epi32(bits, 16);
+    const __m256i lsb = _mm256_and_si256(upper, _mm256_set1_epi32(1));
+    const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(bits, _mm256_set1_epi32(0x7FFF)), lsb), 16);
+    const __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFFFF)), _mm256_set1_epi32(0x7F800000));
+    return _mm256_blendv_epi8(rounded, _mm256_or_si256(upper, _mm256_set1_epi32(0x40)), nan);
 }
 
-uint16_t BitConverter_Reverse_UInt16(uint16_t value) {
-    return (uint16_t)((value >> 8) | (value << 8));
+CMOR_TARGET("avx2") static size_t bfloat16_from_float_avx2(uint16_t *dst, const float *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i a = bfloat16_round_avx2(_mm256_loadu_ps(src + i));
+        __m256i b = bfloat16_round_avx2(_mm256_loadu_ps(src + i + 8));
+        // packus interleaves the 128-bit lanes of a and b; the permute restores element order
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8));
+    }
+    return i;
 }
 
-int32_t BitConverter_Reverse_Int32(int32_t value) {
-    return (int32_t)BitConverter_Reverse_UInt32((uint32_t)value);
+CMOR_TARGET("avx2") static size_t float_from_bfloat16_avx2(float *dst, const uint16_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i wide = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(src + i)));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_slli_epi32(wide, 16));
+    }
+    return i;
+}
+
+CMOR_TARGET("avx512f") static size_t bfloat16_from_float_avx512(uint16_t *dst, const float *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m512i bits = _mm512_castps_si512(_mm512_loadu_ps(src + i));
+        const __m512i upper = _mm512_srli_epi32(bits, 16);
+        const __m512i lsb = _mm512_and_si512(upper, _mm512_set1_epi32(1));
+        __m512i rounded = _mm512_srli_epi32(_mm512_add_epi32(_mm512_add_epi32(bits, _mm512_set1_epi32(0x7FFF)), lsb), 16);
+        const __mmask16 nan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(bits, _mm512_set1_epi32(0x7FFFFFFF)), _mm512_set1_epi32(0x7F800000));
+        rounded = _mm512_mask_or_epi32(rounded, nan, upper, _mm512_set1_epi32(0x40));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm512_cvtepi32_epi16(rounded));
+    }
+    return i;
 }
 
-uint32_t BitConverter_Reverse_UInt32(uint32_t value) {
-    return ((value >> 24) & 0xFF) | 
-           ((value >> 8) & 0xFF00) | 
-           ((value << 8) & 0xFF0000) | 
-           ((value << 24) & 0xFF000000);
+CMOR_TARGET("avx512f") static size_t float_from_bfloat16_avx512(float *dst, const uint16_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512i wide = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)(src + i)));
+        _mm512_storeu_si512(dst + i, _mm512_slli_epi32(wide, 16));
+    }
+    return i;
 }
+#endif // CMOR_X86_SIMD
 
-int64_t BitConverter_Reverse_Int64(int64_t value) {
-    return (int64_t)BitConverter_Reverse_UInt64((uint64_t)value);
+void BitConverter_HalfFromFloatArray(uint16_t dst[], const float src[], size_t count) {
+    size_t done = 0;
+    if (!dst || !src) {
+        return;
+    }
+#if CMOR_X86_SIMD
+    // simd_level() has already run __builtin_cpu_init, so the F16C query is a plain lookup
+    if (simd_level() >= SIMD_AVX512) {
+        done = half_from_float_avx512(dst, src, count);
+    } else if (__builtin_cpu_supports("f16c")) {
+        done = half_from_float_f16c(dst, src, count);
+    }
+#endif
+    for (size_t i = done; i < count; ++i) {
+        dst[i] = BitConverter_HalfFromFloat(src[i]);
+    }
 }
 
-uint64_t BitConverter_Reverse_UInt64(uint64_t value) {
-    uint64_t result = 0;
-    for (int i = 0; i < 8; i++) {
-        result |= ((value >> (i * 8)) & 0xFF) << ((7 - i) * 8);
+void BitConverter_FloatFromHalfArray(float dst[], const uint16_t src[], size_t count) {
+    size_t done = 0;
+    if (!dst || !src) {
+        return;
+    }
+#if CMOR_X86_SIMD
+    if (simd_level() >= SIMD_AVX512) {
+        done = float_from_half_avx512(dst, src, count);
+    } else if (__builtin_cpu_supports("f16c")) {
+        done = float_from_half_f16c(dst, src, count);
+    }
+#endif
+    for (size_t i = done; i < count; ++i) {
+        dst[i] = BitConverter_FloatFromHalf(src[i]);
     }
-    return result;
 }
 
-float BitConverter_Reverse_Float(float value) {
-    uint32_t asInt;
-    memcpy(&asInt, &value, sizeof(float));
-    asInt = BitConverter_Reverse_UInt32(asInt);
-    float result;
-    memcpy(&result, &asInt, sizeof(float));
-    return result;
+void BitConverter_BFloat16FromFloatArray(uint16_t dst[], const float src[], size_t count) {
+    size_t done = 0;
+    if (!dst || !src) {
+        return;
+    }
+#if CMOR_X86_SIMD
+    SimdLevel level = simd_level();
+    if (level >= SIMD_AVX512) {
+        done = bfloat16_from_float_avx512(dst, src, count);
+    } else if (level >= SIMD_AVX2) {
+        done = bfloat16_from_float_avx2(dst, src, count);
+    }
+#endif
+    for (size_t i = done; i < count; ++i) {
+        dst[i] = BitConverter_BFloat16FromFloat(src[i]);
+    }
 }
 
-double BitConverter_Reverse__Double(double value) {
-    uint64_t asInt;
-    memcpy(&asInt, &value, sizeof(double));
-    asInt = BitConverter_Reverse_UInt32(asInt);
-    double result;
-    memcpy(&result, &asInt, sizeof(double));
-    return result;
+void BitConverter_FloatFromBFloat16Array(float dst[], const uint16_t src[], size_t count) {
+    size_t done = 0;
+    if (!dst || !src) {
+        return;
+    }
+#if CMOR_X86_SIMD
+    SimdLevel level = simd_level();
+    if (level >= SIMD_AVX512) {
+        done = float_from_bfloat16_avx512(dst, src, count);
+    } else if (level >= SIMD_AVX2) {
+        done = float_from_bfloat16_avx2(dst, src, count);
+    }
+#endif
+    for (size_t i = done; i < count; ++i) {
+        dst[i] = BitConverter_FloatFromBFloat16(src[i]);
+    }
 }
 
 int16_t BitConverter_Join_Int16(int8_t high, int8_t low) {
@@ -270,7 +519,7 @@ uint16_t BitConverter_Join_UInt16(uint8_t high, uint8_t low) {
 }
 
 int32_t BitConverter_Join_Int32(int16_t high, int16_t low) {
-    return (int32_t)(BitConverter_Join_UInt16((uint16_t) high, (uint16_t) low));
+    return (int32_t)(BitConverter_Join_UInt32((uint16_t) high, (uint16_t) low));
 }
 
 uint32_t BitConverter_Join_UInt32(uint16_t high, uint16_t low) {
@@ -302,7 +551,7 @@ void BitConverter_Split_UInt16(uint16_t value, uint8_t* high, uint8_t* low) {
 }
 
 void BitConverter_Split_Int32(int32_t value, int16_t* high, int16_t* low) {
-    BitConverter_Split_UInt32((uint16_t)value, (uint16_t*)high, (uint16_t*)low);
+    BitConverter_Split_UInt32((uint32_t)value, (uint16_t*)high, (uint16_t*)low);
 }
 
 void BitConverter_Split_UInt32(uint32_t value, uint16_t* high, uint16_t* low) {
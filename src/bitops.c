@@ -0,0 +1,181 @@
+/*!
+ * \file bitops.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Provides function implementations for the out-of-line bit operations.
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "bitops.h"
+#include "simd.h"
+#include <stdbool.h>
+#include <string.h>
+
+// pext and pdep only exist in 64-bit mode
+#if CMOR_X86_SIMD && defined(__x86_64__)
+#define BITOPS_BMI2 1
+#else
+#define BITOPS_BMI2 0
+#endif
+
+static uint64_t extract_portable(uint64_t value, uint64_t mask) {
+    uint64_t result = 0;
+    for (uint64_t bit = 1; mask; mask &= mask - 1, bit <<= 1) {
+        if (value & mask & (0 - mask)) {
+            result |= bit;
+        }
+    }
+    return result;
+}
+
+static uint64_t deposit_portable(uint64_t value, uint64_t mask) {
+    uint64_t result = 0;
+    for (uint64_t bit = 1; mask; mask &= mask - 1, bit <<= 1) {
+        if (value & bit) {
+            result |= mask & (0 - mask);
+        }
+    }
+    return result;
+}
+
+#if BITOPS_BMI2
+CMOR_TARGET("bmi2") static uint64_t extract_bmi2(uint64_t value, uint64_t mask) {
+    return _pext_u64(value, mask);
+}
+
+CMOR_TARGET("bmi2") static uint64_t deposit_bmi2(uint64_t value, uint64_t mask) {
+    return _pdep_u64(value, mask);
+}
+
+static bool has_bmi2(void) {
+    (void)simd_level(); // makes sure __builtin_cpu_init has run
+    return __builtin_cpu_supports("bmi2");
+}
+#endif // BITOPS_BMI2
+
+static uint64_t extract64(uint64_t value, uint64_t mask) {
+#if BITOPS_BMI2
+    if (has_bmi2()) {
+        return extract_bmi2(value, mask);
+    }
+#endif
+    return extract_portable(value, mask);
+}
+
+static uint64_t deposit64(uint64_t value, uint64_t mask) {
+#if BITOPS_BMI2
+    if (has_bmi2()) {
+        return deposit_bmi2(value, mask);
+    }
+#endif
+    return deposit_portable(value, mask);
+}
+
+#define BITOPS_PDEP_DEFINE(suf, T) \
+T bitops_extract_##T(T value, T mask) { \
+    return (T)(BITOPS_UNSIGNED_##suf)extract64((BITOPS_UNSIGNED_##suf)value, (BITOPS_UNSIGNED_##suf)mask); \
+} \
+\
+T bitops_deposit_##T(T value, T mask) { \
+    return (T)(BITOPS_UNSIGNED_##suf)deposit64((BITOPS_UNSIGNED_##suf)value, (BITOPS_UNSIGNED_##suf)mask); \
+}
+
+    STDINT_TYPE_MAP(BITOPS_PDEP_DEFINE)
+
+#undef BITOPS_PDEP_DEFINE
+
+#if CMOR_X86_SIMD
+/*!
+ * \brief Buffer popcount kernels; each adds to *count and returns how many bytes it handled.
+ * \remarks Four independent accumulators (or four vectors per step) keep the adds off the
+ * critical path so the loops are limited by load throughput.
+ */
+CMOR_TARGET("avx512f,avx512vpopcntdq") static size_t popcount_avx512(const uint8_t *data, size_t bytes, size_t *count) {
+    __m512i a = _mm512_setzero_si512(), b = a, c = a, d = a;
+    size_t i = 0;
+    for (; i + 256 <= bytes; i += 256) {
+        a = _mm512_add_epi64(a, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i)));
+        b = _mm512_add_epi64(b, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i + 64)));
+        c = _mm512_add_epi64(c, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i + 128)));
+        d = _mm512_add_epi64(d, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i + 192)));
+    }
+    for (; i + 64 <= bytes; i += 64) {
+        a = _mm512_add_epi64(a, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i)));
+    }
+    *count += (size_t)_mm512_reduce_add_epi64(_mm512_add_epi64(_mm512_add_epi64(a, b), _mm512_add_epi64(c, d)));
+    return i;
+}
+
+/*! \brief Counts each nibble with a pshufb table lookup and sums bytes with psadbw (Mula's method). */
+CMOR_TARGET("avx2") static size_t popcount_avx2(const uint8_t *data, size_t bytes, size_t *count) {
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i total = zero;
+    size_t i = 0;
+#define BITOPS_NIBBLE_COUNT(v) _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(v, low)), \
+    _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low)))
+    for (; i + 128 <= bytes; i += 128) {
+        // each byte of the partial sum is at most 4 * 8 = 32, so it cannot overflow before the psadbw
+        const __m256i v0 = _mm256_loadu_si256((const __m256i *)(data + i));
+        const __m256i v1 = _mm256_loadu_si256((const __m256i *)(data + i + 32));
+        const __m256i v2 = _mm256_loadu_si256((const __m256i *)(data + i + 64));
+        const __m256i v3 = _mm256_loadu_si256((const __m256i *)(data + i + 96));
+        __m256i sum = _mm256_add_epi8(BITOPS_NIBBLE_COUNT(v0), BITOPS_NIBBLE_COUNT(v1));
+        sum = _mm256_add_epi8(sum, _mm256_add_epi8(BITOPS_NIBBLE_COUNT(v2), BITOPS_NIBBLE_COUNT(v3)));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(sum, zero));
+    }
+    for (; i + 32 <= bytes; i += 32) {
+        const __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(BITOPS_NIBBLE_COUNT(v), zero));
+    }
+#undef BITOPS_NIBBLE_COUNT
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, total);
+    *count += (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    return i;
+}
+
+CMOR_TARGET("popcnt") static size_t popcount_popcnt(const uint8_t *data, size_t bytes, size_t *count) {
+    size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        *count += (size_t)__builtin_popcountll(word);
+    }
+    return i;
+}
+#endif // CMOR_X86_SIMD
+
+size_t bitops_popcountArray(const void *data, size_t bytes) {
+    const uint8_t *p = data;
+    size_t count = 0;
+    size_t done = 0;
+    if (!p) {
+        return 0;
+    }
+#if CMOR_X86_SIMD
+    SimdLevel level = simd_level();
+    if (level >= SIMD_AVX512 && __builtin_cpu_supports("avx512vpopcntdq")) {
+        done = popcount_avx512(p, bytes, &count);
+    } else if (level >= SIMD_AVX2) {
+        done = popcount_avx2(p, bytes, &count);
+    }
+    if (__builtin_cpu_supports("popcnt")) {
+        done += popcount_popcnt(p + done, bytes - done, &count);
+    }
+#endif
+    for (; done + 8 <= bytes; done += 8) {
+        uint64_t word;
+        memcpy(&word, p + done, sizeof(word));
+        count += bitops_popcount64(word);
+    }
+    for (; done < bytes; ++done) {
+        count += bitops_popcount64(p[done]);
+    }
+    return count;
+}
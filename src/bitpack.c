@@ -0,0 +1,337 @@
+/*!
+ * \file bitpack.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Provides function implementations for the bit-packing codec.
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "bitpack.h"
+#include "bitconverter.h"
+#include "simd.h"
+#include <string.h>
+
+// SSE2 is part of the x86-64 baseline, so the unpack kernels need no run-time dispatch.
+#if CMOR_X86_SIMD && defined(__SSE2__)
+#define BITPACK_SSE2 1
+#else
+#define BITPACK_SSE2 0
+#endif
+
+static void put_le(uint64_t value, uint8_t *out, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static uint64_t get_le(const uint8_t *in, size_t size) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; ++i) {
+        value |= (uint64_t)in[i] << (8 * i);
+    }
+    return value;
+}
+
+/*!
+ * \brief Macro for the packing kernels on one lane width.
+ * \remarks In a full block, value i sits in lane i % LANES at bit (i / LANES) * width of that lane's
+ * word stream, and word j of lane l is stored at index j * LANES + l. A block therefore always takes
+ * 16 * width bytes, and one vector load fetches the same word of every lane.
+ * A partial block is a plain little-endian bit stream of n * width bits.
+ */
+#define BITPACK_LANE_DEFINE(BITS, LANES) \
+static inline uint##BITS##_t mask##BITS(unsigned width) { \
+    return width == BITS ? (uint##BITS##_t)~(uint##BITS##_t)0 : (uint##BITS##_t)(((uint##BITS##_t)1 << width) - 1); \
+} \
+\
+static void pack##BITS(const uint##BITS##_t v[BITPACK_BLOCK], unsigned width, uint8_t *out) { \
+    uint##BITS##_t words[LANES * BITS]; \
+    if (width == 0) { \
+        return; \
+    } \
+    memset(words, 0, LANES * width * sizeof(words[0])); \
+    for (unsigned i = 0; i < BITPACK_BLOCK; ++i) { \
+        const unsigned lane = i % LANES, bit = (i / LANES) * width; \
+        const unsigned j = bit / BITS, s = bit % BITS; \
+        words[j * LANES + lane] |= v[i] << s; \
+        if (s + width > BITS) { \
+            words[(j + 1) * LANES + lane] |= v[i] >> (BITS - s); \
+        } \
+    } \
+    for (unsigned j = 0; j < LANES * width; ++j) { \
+        BitConverter_WriteUInt##BITS##LE(words[j], out + j * sizeof(words[0])); \
+    } \
+} \
+\
+static inline void unpack##BITS##_scalar(const uint8_t *in, unsigned width, uint##BITS##_t v[BITPACK_BLOCK]) { \
+    const uint##BITS##_t mask = mask##BITS(width); \
+    for (unsigned i = 0; i < BITPACK_BLOCK; ++i) { \
+        const unsigned lane = i % LANES, bit = (i / LANES) * width; \
+        const unsigned j = bit / BITS, s = bit % BITS; \
+        uint##BITS##_t x = BitConverter_ToUInt##BITS##LE(in + (j * LANES + lane) * (BITS / 8)) >> s; \
+        if (s + width > BITS) { \
+            x |= BitConverter_ToUInt##BITS##LE(in + ((j + 1) * LANES + lane) * (BITS / 8)) << (BITS - s); \
+        } \
+        v[i] = x & mask; \
+    } \
+} \
+\
+static void pack_tail##BITS(const uint##BITS##_t v[], size_t n, unsigned width, uint8_t *out) { \
+    size_t bit = 0; \
+    memset(out, 0, (n * width + 7) / 8); \
+    for (size_t i = 0; i < n; ++i) { \
+        uint##BITS##_t x = v[i]; \
+        for (unsigned left = width; left > 0;) { \
+            const unsigned s = bit % 8, take = 8 - s < left ? 8 - s : left; \
+            out[bit / 8] |= (uint8_t)((x & ((1u << take) - 1)) << s); \
+            x >>= take; \
+            bit += take; \
+            left -= take; \
+        } \
+    } \
+} \
+\
+static void unpack_tail##BITS(const uint8_t *in, size_t n, unsigned width, uint##BITS##_t v[]) { \
+    size_t bit = 0; \
+    for (size_t i = 0; i < n; ++i) { \
+        uint##BITS##_t x = 0; \
+        for (unsigned got = 0; got < width;) { \
+            const unsigned s = bit % 8, take = 8 - s < width - got ? 8 - s : width - got; \
+            x |= (uint##BITS##_t)((in[bit / 8] >> s) & ((1u << take) - 1)) << got; \
+            bit += take; \
+            got += take; \
+        } \
+        v[i] = x; \
+    } \
+}
+
+    BITPACK_LANE_DEFINE(32, 4)
+    BITPACK_LANE_DEFINE(64, 2)
+
+#undef BITPACK_LANE_DEFINE
+
+#if BITPACK_SSE2
+/*!
+ * \brief Fully unrolled 32-bit unpack for one width: every shift, mask and word index is a constant,
+ * so each step of four values is a load or two, a shift or two, and a mask.
+ */
+#define BITPACK_WORDS32(j) _mm_loadu_si128((const __m128i *)in + (j))
+#define BITPACK_UNPACK32_STEP(W, K) { \
+    __m128i v = _mm_srli_epi32(BITPACK_WORDS32((K) * (W) / 32), (K) * (W) % 32); \
+    if ((K) * (W) % 32 + (W) > 32) { \
+        v = _mm_or_si128(v, _mm_slli_epi32(BITPACK_WORDS32((K) * (W) / 32 + 1), 32 - (K) * (W) % 32)); \
+    } \
+    _mm_storeu_si128((__m128i *)out + (K), _mm_and_si128(v, mask)); \
+}
+
+#define BITPACK_REP32(M, W) \
+    M(W, 0) M(W, 1) M(W, 2) M(W, 3) M(W, 4) M(W, 5) M(W, 6) M(W, 7) \
+    M(W, 8) M(W, 9) M(W, 10) M(W, 11) M(W, 12) M(W, 13) M(W, 14) M(W, 15) \
+    M(W, 16) M(W, 17) M(W, 18) M(W, 19) M(W, 20) M(W, 21) M(W, 22) M(W, 23) \
+    M(W, 24) M(W, 25) M(W, 26) M(W, 27) M(W, 28) M(W, 29) M(W, 30) M(W, 31)
+
+#define BITPACK_WIDTHS32(M) \
+    M(1) M(2) M(3) M(4) M(5) M(6) M(7) M(8) M(9) M(10) M(11) M(12) M(13) M(14) M(15) M(16) \
+    M(17) M(18) M(19) M(20) M(21) M(22) M(23) M(24) M(25) M(26) M(27) M(28) M(29) M(30) M(31) M(32)
+
+#define BITPACK_UNPACK32_DEFINE(W) \
+static void unpack32_sse2_##W(const uint8_t *restrict in, uint32_t *restrict out) { \
+    const __m128i mask = _mm_set1_epi32((int)mask32(W)); \
+    BITPACK_REP32(BITPACK_UNPACK32_STEP, W) \
+}
+
+    BITPACK_WIDTHS32(BITPACK_UNPACK32_DEFINE)
+
+#define BITPACK_UNPACK32_ENTRY(W) unpack32_sse2_##W,
+static void (*const unpack32_sse2[33])(const uint8_t *restrict, uint32_t *restrict) = {
+    NULL, BITPACK_WIDTHS32(BITPACK_UNPACK32_ENTRY)
+};
+
+#undef BITPACK_UNPACK32_ENTRY
+#undef BITPACK_UNPACK32_DEFINE
+#undef BITPACK_WIDTHS32
+#undef BITPACK_REP32
+#undef BITPACK_UNPACK32_STEP
+#undef BITPACK_WORDS32
+
+/*! \brief 64-bit unpack, two values per step; not unrolled, as 64 widths of 64 steps is too much code. */
+static void unpack64_sse2(const uint8_t *in, unsigned width, uint64_t *out) {
+    const __m128i mask = _mm_set1_epi64x((long long)mask64(width));
+    const __m128i *words = (const __m128i *)in;
+    unsigned bit = 0;
+    for (unsigned k = 0; k < BITPACK_BLOCK / 2; ++k, bit += width) {
+        const unsigned j = bit / 64, s = bit % 64;
+        __m128i v = _mm_srl_epi64(_mm_loadu_si128(words + j), _mm_cvtsi32_si128((int)s));
+        if (s + width > 64) {
+            v = _mm_or_si128(v, _mm_sll_epi64(_mm_loadu_si128(words + j + 1), _mm_cvtsi32_si128((int)(64 - s))));
+        }
+        _mm_storeu_si128((__m128i *)out + k, _mm_and_si128(v, mask));
+    }
+}
+#endif // BITPACK_SSE2
+
+static void unpack32(const uint8_t *in, unsigned width, uint32_t v[BITPACK_BLOCK]) {
+    if (width == 0) {
+        memset(v, 0, BITPACK_BLOCK * sizeof(v[0]));
+        return;
+    }
+#if BITPACK_SSE2
+    unpack32_sse2[width](in, v);
+#else
+    unpack32_scalar(in, width, v);
+#endif
+}
+
+static void unpack64(const uint8_t *in, unsigned width, uint64_t v[BITPACK_BLOCK]) {
+    if (width == 0) {
+        memset(v, 0, BITPACK_BLOCK * sizeof(v[0]));
+        return;
+    }
+#if BITPACK_SSE2
+    unpack64_sse2(in, width, v);
+#else
+    unpack64_scalar(in, width, v);
+#endif
+}
+
+size_t bitpack_max_size(size_t count, size_t elementSize) {
+    return (count + BITPACK_BLOCK - 1) / BITPACK_BLOCK * (1 + elementSize) + count * elementSize;
+}
+
+/*!
+ * \brief Macro for the typed codecs.
+ * \remarks Values are mapped to unsigned keys before frame of reference: signed values get their sign
+ * bit flipped so that key order matches value order, and deltas are always treated as signed,
+ * so a decreasing series costs the same as an increasing one. Deltas carry across blocks.
+ * Types narrower than 64 bits are packed in 32-bit lanes.
+ */
+#define BITPACK_DEFINE(T, UT, LANE, SIGNED) \
+BitpackStatus bitpack_encode_##T(const T src[], size_t count, BitpackMode mode, \
+                                 uint8_t out[], size_t outSize, size_t *written) { \
+    const UT top = (UT)((UT)1 << (8 * sizeof(UT) - 1)); \
+    const UT flip = mode == BITPACK_FOR && SIGNED ? top : 0; \
+    BitpackStatus status = BITPACK_SUCCESS; \
+    size_t pos = 0; \
+    if ((!src && count) || (!out && outSize) || (unsigned)mode > BITPACK_DELTA) { \
+        status = BITPACK_INVALID; \
+    } else { \
+        uint##LANE##_t res[BITPACK_BLOCK]; \
+        UT prev = 0; \
+        for (size_t base = 0; base < count; base += BITPACK_BLOCK) { \
+            const size_t n = count - base < BITPACK_BLOCK ? count - base : BITPACK_BLOCK; \
+            UT lo = (UT)~(UT)0, hi = 0; \
+            for (size_t i = 0; i < n; ++i) { \
+                UT key = (UT)src[base + i]; \
+                if (mode == BITPACK_DELTA) { \
+                    const UT delta = (UT)(key - prev); \
+                    prev = key; \
+                    key = (UT)(delta ^ top); \
+                } else { \
+                    key ^= flip; \
+                } \
+                res[i] = key; \
+                lo = key < lo ? key : lo; \
+                hi = key > hi ? key : hi; \
+            } \
+            if (mode == BITPACK_NONE) { \
+                lo = 0; \
+            } \
+            const UT range = (UT)(hi - lo); \
+            const unsigned width = range ? BitConverter_Log2Int(range) + 1u : 0u; \
+            const size_t payload = n == BITPACK_BLOCK ? 16u * width : (n * width + 7) / 8; \
+            if (outSize - pos < 1 + sizeof(UT) + payload) { \
+                status = BITPACK_END; \
+                break; \
+            } \
+            out[pos] = (uint8_t)width; \
+            put_le(lo, out + pos + 1, sizeof(UT)); \
+            pos += 1 + sizeof(UT); \
+            for (size_t i = 0; i < n; ++i) { \
+                res[i] = (UT)(res[i] - lo); \
+            } \
+            if (n == BITPACK_BLOCK) { \
+                pack##LANE(res, width, out + pos); \
+            } else { \
+                pack_tail##LANE(res, n, width, out + pos); \
+            } \
+            pos += payload; \
+        } \
+    } \
+    if (written) { \
+        *written = pos; \
+    } \
+    return status; \
+} \
+\
+BitpackStatus bitpack_decode_##T(const uint8_t in[], size_t inSize, BitpackMode mode, \
+                                 T dst[], size_t count, size_t *consumed) { \
+    const UT top = (UT)((UT)1 << (8 * sizeof(UT) - 1)); \
+    const UT flip = mode == BITPACK_FOR && SIGNED ? top : 0; \
+    BitpackStatus status = BITPACK_SUCCESS; \
+    size_t pos = 0; \
+    if ((!in && inSize) || (!dst && count) || (unsigned)mode > BITPACK_DELTA) { \
+        status = BITPACK_INVALID; \
+    } else { \
+        uint##LANE##_t res[BITPACK_BLOCK]; \
+        UT prev = 0; \
+        for (size_t base = 0; base < count; base += BITPACK_BLOCK) { \
+            const size_t n = count - base < BITPACK_BLOCK ? count - base : BITPACK_BLOCK; \
+            if (inSize - pos < 1 + sizeof(UT)) { \
+                status = BITPACK_END; \
+                break; \
+            } \
+            const unsigned width = in[pos]; \
+            if (width > 8 * sizeof(UT)) { \
+                status = BITPACK_CORRUPT; \
+                break; \
+            } \
+            const UT lo = (UT)get_le(in + pos + 1, sizeof(UT)); \
+            const size_t payload = n == BITPACK_BLOCK ? 16u * width : (n * width + 7) / 8; \
+            if (inSize - pos - 1 - sizeof(UT) < payload) { \
+                status = BITPACK_END; \
+                break; \
+            } \
+            pos += 1 + sizeof(UT); \
+            if (n == BITPACK_BLOCK) { \
+                unpack##LANE(in + pos, width, res); \
+            } else { \
+                unpack_tail##LANE(in + pos, n, width, res); \
+            } \
+            pos += payload; \
+            T *restrict out = dst + base; \
+            if (mode == BITPACK_DELTA) { \
+                for (size_t i = 0; i < n; ++i) { \
+                    prev = (UT)(prev + (UT)((UT)(res[i] + lo) ^ top)); \
+                    out[i] = (T)prev; \
+                } \
+            } else { \
+                for (size_t i = 0; i < n; ++i) { \
+                    out[i] = (T)(UT)((UT)(res[i] + lo) ^ flip); \
+                } \
+            } \
+        } \
+    } \
+    if (consumed) { \
+        *consumed = pos; \
+    } \
+    return status; \
+}
+
+/*! Types with bit-packing codecs: type, unsigned key type, lane width, signedness */
+#define BITPACK_TYPE_MAP(FMACRO) \
+    FMACRO(int8_t, uint8_t, 32, 1) \
+    FMACRO(int16_t, uint16_t, 32, 1) \
+    FMACRO(int32_t, uint32_t, 32, 1) \
+    FMACRO(int64_t, uint64_t, 64, 1) \
+    FMACRO(uint8_t, uint8_t, 32, 0) \
+    FMACRO(uint16_t, uint16_t, 32, 0) \
+    FMACRO(uint32_t, uint32_t, 32, 0) \
+    FMACRO(uint64_t, uint64_t, 64, 0)
+
+    BITPACK_TYPE_MAP(BITPACK_DEFINE)
+
+#undef BITPACK_TYPE_MAP
+#undef BITPACK_DEFINE
@@ -0,0 +1,134 @@
+/*!
+ * \file fir.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Provides function implementations for streaming FIR filters.
+ * \version 0.1
+ * \date 2026-10-16
+ * 
+ * \copyright Copyright (c) 2026
+ * 
+ */
+
+#include "fir.h"
+#include <string.h>
+
+#define FIR_INIT_DEFINE(T) \
+FirStatus fir_init_##T(FirFilter_##T *f, const T taps[], size_t tapCount, T state[], size_t stateLen) { \
+    if (!f || !taps || tapCount == 0) { \
+        return FIR_INVALID; \
+    } \
+    if (tapCount > 1 && (!state || stateLen < tapCount - 1)) { \
+        return FIR_INVALID; \
+    } \
+    f->taps = taps; \
+    f->tapCount = tapCount; \
+    f->history = state; \
+    f->primed = 0; \
+    return FIR_SUCCESS; \
+}
+
+    TYPE_ITERATOR(FIR_INIT_DEFINE)
+
+#undef FIR_INIT_DEFINE
+
+/*!
+ * \brief Macro for generic FIR block processing definitions.
+ * \remarks Outputs within tapCount - 1 samples of the block start read the older samples
+ * from the history; the rest read only the current block. Samples from before the stream
+ * started are skipped rather than treated as zero, just like the bounds in \ref convolve.
+ * Afterwards the history is slid forward by n samples.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define FIR_PROCESS_DEFINE(T) \
+FirStatus fir_process_##T(FirFilter_##T *f, const T in[], T out[], size_t n) { \
+    if (!f || !f->taps || (n > 0 && (!in || !out))) { \
+        return FIR_INVALID; \
+    } \
+    const T *h = f->taps; \
+    const size_t order = f->tapCount - 1; \
+    T *hist = f->history; \
+    \
+    for (size_t i = 0; i < n; ++i) { \
+        T acc = 0; \
+        size_t back = (i < order) ? order - i : 0; \
+        size_t skip = (back > f->primed) ? back - f->primed : 0; \
+        for (size_t k = skip; k < back; ++k) { \
+            acc += hist[order - back + k] * h[i + back - k]; \
+        } \
+        for (size_t j = (i >= order) ? i - order : 0; j <= i; ++j) { \
+            acc += in[j] * h[i - j]; \
+        } \
+        out[i] = acc; \
+    } \
+    \
+    if (order == 0) { \
+        return FIR_SUCCESS; \
+    } \
+    if (n >= order) { \
+        memcpy(hist, in + (n - order), order * sizeof(T)); \
+        f->primed = order; \
+    } else { \
+        memmove(hist, hist + n, (order - n) * sizeof(T)); \
+        memcpy(hist + (order - n), in, n * sizeof(T)); \
+        f->primed = (f->primed + n < order) ? f->primed + n : order; \
+    } \
+    return FIR_SUCCESS; \
+}
+
+    TYPE_ITERATOR(FIR_PROCESS_DEFINE)
+
+#undef FIR_PROCESS_DEFINE
+
+/*!
+ * \brief Macro for generic FIR flush definitions.
+ * \remarks Tail sample t only sums the history samples that still overlap the kernel,
+ * so no implicit trailing zeros enter the sum.
+ *
+ * \version 0.1
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \date 2026-10-16
+ * \copyright Copyright (c) 2026
+ */
+#define FIR_FLUSH_DEFINE(T) \
+FirStatus fir_flush_##T(FirFilter_##T *f, T out[], size_t outLen) { \
+    if (!f || !f->taps) { \
+        return FIR_INVALID; \
+    } \
+    const size_t order = f->tapCount - 1; \
+    if (order > 0 && (!out || outLen < order)) { \
+        return FIR_INVALID; \
+    } \
+    const T *h = f->taps; \
+    const T *hist = f->history; \
+    for (size_t t = 0; t < order; ++t) { \
+        T acc = 0; \
+        size_t first = order - f->primed; \
+        for (size_t p = (t > first) ? t : first; p < order; ++p) { \
+            acc += hist[p] * h[t + order - p]; \
+        } \
+        out[t] = acc; \
+    } \
+    f->primed = 0; \
+    return FIR_SUCCESS; \
+}
+
+    TYPE_ITERATOR(FIR_FLUSH_DEFINE)
+
+#undef FIR_FLUSH_DEFINE
+
+#define FIR_RESET_DEFINE(T) \
+FirStatus fir_reset_##T(FirFilter_##T *f) { \
+    if (!f) { \
+        return FIR_INVALID; \
+    } \
+    f->primed = 0; \
+    return FIR_SUCCESS; \
+}
+
+    TYPE_ITERATOR(FIR_RESET_DEFINE)
+
+#undef FIR_RESET_DEFINE
@@ -0,0 +1,321 @@
+/*!
+ * \file hash.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Provides function implementations for CRC32C and XXH64.
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "hash.h"
+#include "bitconverter.h"
+#include "bitops.h"
+#include "once.h"
+#include "simd.h"
+#include <stdbool.h>
+#include <string.h>
+
+/*
+ * CRC32C works on bit-reflected values: bit 31 of a uint32_t holds the coefficient of x^0 and
+ * bit 0 that of x^31, and the raw state (between the initial and final inversions) after some
+ * data is that data's polynomial times x^32, modulo the Castagnoli polynomial.
+ */
+#define CRC32C_POLY 0x82F63B78u
+
+/*! Interleaved lane lengths in bytes for the three-stream hardware loop, longest first */
+static const size_t crc32c_lanes[2] = { 1024, 128 };
+
+static uint32_t crc32c_table[8][256]; //!< slicing-by-8 tables
+static uint32_t crc32c_x2n[32]; //!< x^(2^n) mod P
+static uint64_t crc32c_shift[2][2]; //!< x^(8 * lane * m - 33) mod P for m = 1, 2 and each lane length
+
+/*! \brief a(x) * b(x) mod P; a must not be zero. */
+static uint32_t multmodp(uint32_t a, uint32_t b) {
+    uint32_t m = UINT32_C(1) << 31, p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0) {
+                break;
+            }
+        }
+        m >>= 1;
+        b = b & 1 ? (b >> 1) ^ CRC32C_POLY : b >> 1;
+    }
+    return p;
+}
+
+/*! \brief x^(n * 2^k) mod P. */
+static uint32_t x2nmodp(uint64_t n, unsigned k) {
+    uint32_t p = UINT32_C(1) << 31; // x^0
+    for (; n; n >>= 1, ++k) {
+        if (n & 1) {
+            p = multmodp(crc32c_x2n[k & 31], p);
+        }
+    }
+    return p;
+}
+
+static void crc32c_build_tables(void) {
+    for (uint32_t n = 0; n < 256; ++n) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; ++k) {
+            c = c & 1 ? (c >> 1) ^ CRC32C_POLY : c >> 1;
+        }
+        crc32c_table[0][n] = c;
+    }
+    for (uint32_t n = 0; n < 256; ++n) {
+        uint32_t c = crc32c_table[0][n];
+        for (int k = 1; k < 8; ++k) {
+            c = crc32c_table[0][c & 0xFF] ^ (c >> 8);
+            crc32c_table[k][n] = c;
+        }
+    }
+    uint32_t p = UINT32_C(1) << 30; // x^1
+    crc32c_x2n[0] = p;
+    for (int n = 1; n < 32; ++n) {
+        crc32c_x2n[n] = p = multmodp(p, p);
+    }
+    for (int t = 0; t < 2; ++t) {
+        crc32c_shift[t][0] = x2nmodp(8 * crc32c_lanes[t] - 33, 0);
+        crc32c_shift[t][1] = x2nmodp(16 * crc32c_lanes[t] - 33, 0);
+    }
+}
+
+static void crc32c_init_tables(void) {
+    static CmorOnce once = CMOR_ONCE_INIT;
+    cmor_once(&once, crc32c_build_tables);
+}
+
+/*! \brief Slicing-by-8: eight table lookups per 8 bytes, all independent of each other. */
+static uint32_t crc32c_portable(uint32_t state, const uint8_t *p, size_t len) {
+    for (; len >= 8; p += 8, len -= 8) {
+        const uint64_t w = BitConverter_ToUInt64LE(p) ^ state;
+        state = crc32c_table[7][w & 0xFF] ^ crc32c_table[6][(w >> 8) & 0xFF] ^
+                crc32c_table[5][(w >> 16) & 0xFF] ^ crc32c_table[4][(w >> 24) & 0xFF] ^
+                crc32c_table[3][(w >> 32) & 0xFF] ^ crc32c_table[2][(w >> 40) & 0xFF] ^
+                crc32c_table[1][(w >> 48) & 0xFF] ^ crc32c_table[0][w >> 56];
+    }
+    for (; len; ++p, --len) {
+        state = crc32c_table[0][(state ^ *p) & 0xFF] ^ (state >> 8);
+    }
+    return state;
+}
+
+#if CMOR_X86_SIMD
+CMOR_TARGET("sse4.2") static uint32_t crc32c_sse42(uint32_t state, const uint8_t *p, size_t len) {
+#if defined(__x86_64__)
+    uint64_t c = state;
+    for (; len >= 8; p += 8, len -= 8) {
+        uint64_t w;
+        memcpy(&w, p, sizeof(w));
+        c = _mm_crc32_u64(c, w);
+    }
+    state = (uint32_t)c;
+#endif
+    for (; len >= 4; p += 4, len -= 4) {
+        uint32_t w;
+        memcpy(&w, p, sizeof(w));
+        state = _mm_crc32_u32(state, w);
+    }
+    for (; len; ++p, --len) {
+        state = _mm_crc32_u8(state, *p);
+    }
+    return state;
+}
+
+#if defined(__x86_64__)
+/*!
+ * \brief Advances a raw state over zero bytes using a precomputed power of x.
+ * \remarks The carry-less product of two reflected values is their product times x; crc32 of
+ * that as a 64-bit word multiplies by another x^32 and reduces mod P, so a constant of
+ * x^(8n - 33) advances the state by n bytes.
+ */
+CMOR_TARGET("sse4.2,pclmul") static inline uint32_t crc32c_advance(uint32_t state, uint64_t power) {
+    const __m128i product = _mm_clmulepi64_si128(_mm_cvtsi32_si128((int)state), _mm_cvtsi64_si128((long long)power), 0x00);
+    return (uint32_t)_mm_crc32_u64(0, (uint64_t)_mm_cvtsi128_si64(product));
+}
+
+/*!
+ * \brief Runs three independent crc32 chains over adjacent lanes of a block and joins them.
+ * \remarks A single chain is bound by the instruction's three-cycle latency; three chains keep the
+ * unit busy every cycle. Returns how many bytes it consumed, a multiple of the shortest block.
+ */
+CMOR_TARGET("sse4.2,pclmul") static size_t crc32c_interleaved(uint32_t *state, const uint8_t *p, size_t len) {
+    size_t done = 0;
+    for (int t = 0; t < 2; ++t) {
+        const size_t lane = crc32c_lanes[t];
+        for (; len - done >= 3 * lane; done += 3 * lane) {
+            const uint8_t *a = p + done, *b = a + lane, *c = b + lane;
+            uint64_t ca = *state, cb = 0, cc = 0;
+            for (size_t i = 0; i < lane; i += 8) {
+                uint64_t wa, wb, wc;
+                memcpy(&wa, a + i, sizeof(wa));
+                memcpy(&wb, b + i, sizeof(wb));
+                memcpy(&wc, c + i, sizeof(wc));
+                ca = _mm_crc32_u64(ca, wa);
+                cb = _mm_crc32_u64(cb, wb);
+                cc = _mm_crc32_u64(cc, wc);
+            }
+            *state = crc32c_advance((uint32_t)ca, crc32c_shift[t][1]) ^
+                     crc32c_advance((uint32_t)cb, crc32c_shift[t][0]) ^ (uint32_t)cc;
+        }
+    }
+    return done;
+}
+#endif // __x86_64__
+#endif // CMOR_X86_SIMD
+
+uint32_t crc32c(uint32_t crc, const void *data, size_t len) {
+    const uint8_t *p = data;
+    uint32_t state = ~crc;
+    if (p == NULL || len == 0) {
+        return crc;
+    }
+    crc32c_init_tables();
+#if CMOR_X86_SIMD
+    (void)simd_level(); // makes sure __builtin_cpu_init has run
+    if (__builtin_cpu_supports("sse4.2")) {
+#if defined(__x86_64__)
+        if (__builtin_cpu_supports("pclmul")) {
+            const size_t done = crc32c_interleaved(&state, p, len);
+            p += done;
+            len -= done;
+        }
+#endif
+        return ~crc32c_sse42(state, p, len);
+    }
+#endif
+    return ~crc32c_portable(state, p, len);
+}
+
+uint32_t crc32c_combine(uint32_t crcA, uint32_t crcB, size_t lenB) {
+    crc32c_init_tables();
+    // the inversions cancel: only crcA's state has to move past lenB zero bytes
+    return multmodp(x2nmodp(lenB, 3), crcA) ^ crcB;
+}
+
+#define XXH_PRIME64_1 UINT64_C(0x9E3779B185EBCA87)
+#define XXH_PRIME64_2 UINT64_C(0xC2B2AE3D27D4EB4F)
+#define XXH_PRIME64_3 UINT64_C(0x165667B19E3779F9)
+#define XXH_PRIME64_4 UINT64_C(0x85EBCA77C2B2AE63)
+#define XXH_PRIME64_5 UINT64_C(0x27D4EB2F165667C5)
+
+static inline uint64_t xxh64_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME64_2;
+    return bitops_rotl_uint64_t(acc, 31) * XXH_PRIME64_1;
+}
+
+static inline uint64_t xxh64_merge(uint64_t acc, uint64_t lane) {
+    acc ^= xxh64_round(0, lane);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+/*! \brief Consumes whole 32-byte stripes; returns the bytes consumed. The four lanes are independent. */
+static size_t xxh64_stripes(uint64_t lanes[4], const uint8_t *p, size_t len) {
+    uint64_t v1 = lanes[0], v2 = lanes[1], v3 = lanes[2], v4 = lanes[3];
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        v1 = xxh64_round(v1, BitConverter_ToUInt64LE(p + i));
+        v2 = xxh64_round(v2, BitConverter_ToUInt64LE(p + i + 8));
+        v3 = xxh64_round(v3, BitConverter_ToUInt64LE(p + i + 16));
+        v4 = xxh64_round(v4, BitConverter_ToUInt64LE(p + i + 24));
+    }
+    lanes[0] = v1;
+    lanes[1] = v2;
+    lanes[2] = v3;
+    lanes[3] = v4;
+    return i;
+}
+
+/*! \brief Folds the lanes (if any stripe was hashed), the length and the final < 32 bytes. */
+static uint64_t xxh64_finish(const uint64_t lanes[4], uint64_t total, uint64_t seed, const uint8_t *p, size_t len) {
+    uint64_t h;
+    if (total >= 32) {
+        h = bitops_rotl_uint64_t(lanes[0], 1) + bitops_rotl_uint64_t(lanes[1], 7) +
+            bitops_rotl_uint64_t(lanes[2], 12) + bitops_rotl_uint64_t(lanes[3], 18);
+        for (int k = 0; k < 4; ++k) {
+            h = xxh64_merge(h, lanes[k]);
+        }
+    } else {
+        h = seed + XXH_PRIME64_5;
+    }
+    h += total;
+    for (; len >= 8; p += 8, len -= 8) {
+        h ^= xxh64_round(0, BitConverter_ToUInt64LE(p));
+        h = bitops_rotl_uint64_t(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+    if (len >= 4) {
+        h ^= (uint64_t)BitConverter_ToUInt32LE(p) * XXH_PRIME64_1;
+        h = bitops_rotl_uint64_t(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+        len -= 4;
+    }
+    for (; len; ++p, --len) {
+        h ^= *p * XXH_PRIME64_5;
+        h = bitops_rotl_uint64_t(h, 11) * XXH_PRIME64_1;
+    }
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+void hash64_init(Hash64State *state, uint64_t seed) {
+    if (state == NULL) {
+        return;
+    }
+    state->lanes[0] = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+    state->lanes[1] = seed + XXH_PRIME64_2;
+    state->lanes[2] = seed;
+    state->lanes[3] = seed - XXH_PRIME64_1;
+    state->total = 0;
+    state->seed = seed;
+    state->buffered = 0;
+}
+
+uint64_t hash64(const void *data, size_t len, uint64_t seed) {
+    Hash64State state;
+    const uint8_t *p = data ? data : (const void *)"";
+    if (data == NULL) {
+        len = 0;
+    }
+    hash64_init(&state, seed);
+    const size_t done = xxh64_stripes(state.lanes, p, len);
+    return xxh64_finish(state.lanes, len, seed, p + done, len - done);
+}
+
+void hash64_update(Hash64State *state, const void *data, size_t len) {
+    const uint8_t *p = data;
+    if (state == NULL || p == NULL || len == 0) {
+        return;
+    }
+    state->total += len;
+    if (state->buffered + len < 32) {
+        memcpy(state->buffer + state->buffered, p, len);
+        state->buffered += (uint32_t)len;
+        return;
+    }
+    if (state->buffered) {
+        const size_t fill = 32 - state->buffered;
+        memcpy(state->buffer + state->buffered, p, fill);
+        xxh64_stripes(state->lanes, state->buffer, 32);
+        p += fill;
+        len -= fill;
+        state->buffered = 0;
+    }
+    const size_t done = xxh64_stripes(state->lanes, p, len);
+    state->buffered = (uint32_t)(len - done);
+    memcpy(state->buffer, p + done, state->buffered);
+}
+
+uint64_t hash64_digest(const Hash64State *state) {
+    if (state == NULL) {
+        return 0;
+    }
+    return xxh64_finish(state->lanes, state->total, state->seed, state->buffer, state->buffered);
+}
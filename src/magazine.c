@@ -0,0 +1,214 @@
+/*!
+ * \file magazine.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Provides function implementations for the magazine caches.
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "magazine.h"
+
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+
+static tss_t thread_caches; //!< head of the calling thread's list of registered caches
+static atomic_bool thread_caches_ready; // atomic only so race checkers see call_once's ordering
+
+static void release(MagazineCache *cache);
+
+static void thread_exit(void *head) {
+    for (MagazineCache *c = head, *next; c; c = next) {
+        next = c->nextInThread;
+        release(c);
+    }
+}
+
+static void thread_caches_create(void) {
+    atomic_store_explicit(&thread_caches_ready, tss_create(&thread_caches, thread_exit) == thrd_success,
+                          memory_order_release);
+}
+
+static void thread_caches_init(void) {
+    static once_flag once = ONCE_FLAG_INIT;
+    call_once(&once, thread_caches_create);
+}
+#endif
+
+bool md_init(MagazineDepot *depot, AtomicMemoryPool *pool, Magazine magazines[], size_t magazineCount) {
+    if (!depot || !pool || !pool->initialized || (!magazines && magazineCount)) {
+        return false;
+    }
+    const size_t bytes = magazineCount * sizeof(Magazine);
+    if (!amp_init(&depot->empty, magazines, bytes, sizeof(Magazine), magazineCount, NULL) ||
+        !amp_init(&depot->full, magazines, bytes, sizeof(Magazine), magazineCount, NULL)) {
+        return false;
+    }
+    // both stacks span the same array; the full one starts out empty
+    while (amp_alloc(&depot->full)) {
+    }
+    for (size_t i = 0; i < magazineCount; ++i) {
+        magazines[i].count = 0;
+    }
+    depot->pool = pool;
+    return true;
+}
+
+#ifndef __STDC_NO_THREADS__
+/*! \brief Whether cache is on the calling thread's list; only follows pointers of registered caches. */
+static bool registered(const MagazineCache *cache) {
+    if (!atomic_load_explicit(&thread_caches_ready, memory_order_acquire)) {
+        return false;
+    }
+    for (const MagazineCache *c = tss_get(thread_caches); c; c = c->nextInThread) {
+        if (c == cache) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+bool mc_init(MagazineCache *cache, MagazineDepot *depot) {
+    if (!cache || !depot) {
+        return false;
+    }
+#ifndef __STDC_NO_THREADS__
+    // initializing twice would link the cache to itself, and thread_exit would never finish
+    if (registered(cache)) {
+        mc_drain(cache);
+    }
+#endif
+    cache->depot = depot;
+    cache->loaded = amp_alloc(&depot->empty);
+    cache->previous = cache->loaded ? amp_alloc(&depot->empty) : NULL;
+    cache->nextInThread = NULL;
+    if (!cache->previous) {
+        if (cache->loaded) {
+            amp_free(&depot->empty, cache->loaded);
+            cache->loaded = NULL;
+        }
+        return false;
+    }
+#ifndef __STDC_NO_THREADS__
+    thread_caches_init();
+    if (atomic_load_explicit(&thread_caches_ready, memory_order_acquire)) {
+        cache->nextInThread = tss_get(thread_caches);
+        tss_set(thread_caches, cache);
+    }
+#endif
+    return true;
+}
+
+/*! \brief Hands a magazine back: to the full stack if it is full, else emptied into the pool. */
+static void return_magazine(MagazineDepot *depot, Magazine *m) {
+    if (m->count == MAGAZINE_CAPACITY) {
+        amp_free(&depot->full, m);
+        return;
+    }
+    while (m->count > 0) {
+        amp_free(depot->pool, m->blocks[--m->count]);
+    }
+    amp_free(&depot->empty, m);
+}
+
+static void release(MagazineCache *cache) {
+    if (cache->loaded) {
+        return_magazine(cache->depot, cache->loaded);
+        return_magazine(cache->depot, cache->previous);
+        cache->loaded = NULL;
+        cache->previous = NULL;
+    }
+}
+
+void mc_drain(MagazineCache *cache) {
+    if (!cache || !cache->depot) {
+        return;
+    }
+    release(cache);
+#ifndef __STDC_NO_THREADS__
+    if (atomic_load_explicit(&thread_caches_ready, memory_order_acquire)) {
+        MagazineCache *head = tss_get(thread_caches);
+        if (head == cache) {
+            tss_set(thread_caches, cache->nextInThread);
+        } else {
+            for (MagazineCache *c = head; c; c = c->nextInThread) {
+                if (c->nextInThread == cache) {
+                    c->nextInThread = cache->nextInThread;
+                    break;
+                }
+            }
+        }
+    }
+#endif
+    cache->nextInThread = NULL;
+}
+
+static void swap_magazines(MagazineCache *cache) {
+    Magazine *m = cache->loaded;
+    cache->loaded = cache->previous;
+    cache->previous = m;
+}
+
+void *mc_allocSlow(MagazineCache *cache) {
+    if (!cache || !cache->depot) {
+        return NULL;
+    }
+    MagazineDepot *depot = cache->depot;
+    if (!cache->loaded) {
+        return amp_alloc(depot->pool);
+    }
+    // loaded is empty: try the spare, then a full magazine from the depot
+    if (cache->previous->count > 0) {
+        swap_magazines(cache);
+        return cache->loaded->blocks[--cache->loaded->count];
+    }
+    Magazine *full = amp_alloc(&depot->full);
+    if (full) {
+        amp_free(&depot->empty, cache->previous);
+        cache->previous = cache->loaded;
+        cache->loaded = full;
+        return full->blocks[--full->count];
+    }
+    // no full magazines anywhere: refill half of one straight from the pool
+    Magazine *m = cache->loaded;
+    while (m->count < MAGAZINE_CAPACITY / 2) {
+        void *block = amp_alloc(depot->pool);
+        if (!block) {
+            break;
+        }
+        m->blocks[m->count++] = block;
+    }
+    return m->count > 0 ? m->blocks[--m->count] : NULL;
+}
+
+void mc_freeSlow(MagazineCache *cache, void *ptr) {
+    if (!cache || !cache->depot || !ptr) {
+        return;
+    }
+    MagazineDepot *depot = cache->depot;
+    if (!cache->loaded) {
+        amp_free(depot->pool, ptr);
+        return;
+    }
+    // loaded is full: try the spare, then an empty magazine from the depot
+    if (cache->previous->count < MAGAZINE_CAPACITY) {
+        swap_magazines(cache);
+    } else {
+        Magazine *empty = amp_alloc(&depot->empty);
+        if (empty) {
+            amp_free(&depot->full, cache->previous);
+            cache->previous = cache->loaded;
+            cache->loaded = empty;
+        } else {
+            // no empty magazines anywhere: send half of the loaded one back to the pool
+            Magazine *m = cache->loaded;
+            while (m->count > MAGAZINE_CAPACITY / 2) {
+                amp_free(depot->pool, m->blocks[--m->count]);
+            }
+        }
+    }
+    cache->loaded->blocks[cache->loaded->count++] = ptr;
+}
@@ -0,0 +1,171 @@
+/*!
+ * \file mappedfile.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Provides function implementations for the memory-mapped file views.
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L // mmap, posix_madvise, O_CLOEXEC
+
+#include "mappedfile.h"
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#define MAPPEDFILE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#define MAPPEDFILE_MMAP 0
+#endif
+
+static bool needs_swap(BinaryEndian endian) {
+    return (endian == BINARY_BIG_ENDIAN) == (bool)BITCONVERTER_HOST_LITTLE;
+}
+
+#if MAPPEDFILE_MMAP
+/*! \brief Closes fd after a failure without losing the errno of the failure. */
+static MappedStatus fail_close(int fd) {
+    const int saved = errno;
+    close(fd);
+    errno = saved;
+    return MAPPED_IO;
+}
+#endif
+
+MappedStatus mv_open(MappedView *v, const char *path, size_t offset, size_t elementSize, BinaryEndian endian) {
+    if (v == NULL || path == NULL ||
+        (elementSize != 1 && elementSize != 2 && elementSize != 4 && elementSize != 8) ||
+        (endian != BINARY_LITTLE_ENDIAN && endian != BINARY_BIG_ENDIAN)) {
+        return MAPPED_INVALID;
+    }
+#if MAPPEDFILE_MMAP
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return MAPPED_IO;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        return fail_close(fd);
+    }
+    if (!S_ISREG(st.st_mode)) {
+        errno = ENODEV; // what mmap reports for files it cannot map
+        return fail_close(fd);
+    }
+    if ((uintmax_t)st.st_size > SIZE_MAX) {
+        errno = EOVERFLOW;
+        return fail_close(fd);
+    }
+    const size_t size = (size_t)st.st_size;
+    if (offset > size) {
+        close(fd);
+        return MAPPED_END;
+    }
+    void *base = NULL;
+    if (size > 0) {
+        base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED) {
+            return fail_close(fd);
+        }
+    }
+    close(fd); // the mapping keeps its own reference to the file
+    v->base = base;
+    v->mapSize = size;
+    v->data = base ? (const uint8_t *)base + offset : NULL;
+    v->count = (size - offset) / elementSize;
+    v->elementSize = elementSize;
+    v->endian = endian;
+    v->swap = elementSize > 1 && needs_swap(endian);
+    return MAPPED_SUCCESS;
+#else
+    (void)offset;
+    return MAPPED_UNSUPPORTED;
+#endif
+}
+
+MappedStatus mv_close(MappedView *v) {
+    if (v == NULL) {
+        return MAPPED_INVALID;
+    }
+    MappedStatus status = MAPPED_SUCCESS;
+#if MAPPEDFILE_MMAP
+    if (v->base != NULL && munmap((void *)v->base, v->mapSize) != 0) {
+        status = MAPPED_IO;
+    }
+#endif
+    v->base = NULL;
+    v->mapSize = 0;
+    v->data = NULL;
+    v->count = 0;
+    return status;
+}
+
+MappedStatus mv_advise(const MappedView *v, size_t first, size_t count, MappedAdvice advice) {
+    if (v == NULL || (unsigned)advice > MAPPED_ADVICE_DONTNEED) {
+        return MAPPED_INVALID;
+    }
+    if (count > v->count || first > v->count - count) {
+        return MAPPED_END;
+    }
+    if (count == 0 || v->base == NULL) {
+        return MAPPED_SUCCESS;
+    }
+#if MAPPEDFILE_MMAP
+    static const int hints[] = {
+        POSIX_MADV_NORMAL, POSIX_MADV_SEQUENTIAL, POSIX_MADV_RANDOM, POSIX_MADV_WILLNEED, POSIX_MADV_DONTNEED
+    };
+    const long page = sysconf(_SC_PAGESIZE);
+    const size_t pageSize = page > 0 ? (size_t)page : 4096;
+    // the mapping starts on a page boundary, so rounding the offset from base aligns the address
+    const size_t begin = (size_t)(v->data - v->base) + first * v->elementSize;
+    const size_t start = begin / pageSize * pageSize;
+    const size_t length = begin + count * v->elementSize - start;
+    const int rc = posix_madvise((void *)(v->base + start), length, hints[advice]);
+    if (rc != 0) {
+        errno = rc;
+        return MAPPED_IO;
+    }
+#endif
+    return MAPPED_SUCCESS;
+}
+
+/*!
+ * \brief Macro for the bulk range copies.
+ * \remarks As in br_readArray, the swap happens during the copy, so each element is read from the
+ * mapping once and written to dest once.
+ */
+#define MAPPEDFILE_COPY_DEFINE(NAME, T) \
+MappedStatus mv_copy##NAME(const MappedView *v, size_t first, size_t count, T dest[]) { \
+    if (v == NULL || (dest == NULL && count > 0) || v->elementSize != sizeof(T)) { \
+        return MAPPED_INVALID; \
+    } \
+    if (count > v->count || first > v->count - count) { \
+        return MAPPED_END; \
+    } \
+    if (count == 0) { \
+        return MAPPED_SUCCESS; \
+    } \
+    const uint8_t *src = v->data + first * sizeof(T); \
+    if (sizeof(T) > 1 && v->swap) { \
+        BitConverter_ReverseArray_Bytes(dest, src, count, sizeof(T)); \
+    } else { \
+        memcpy(dest, src, count * sizeof(T)); \
+    } \
+    return MAPPED_SUCCESS; \
+}
+
+    MAPPEDFILE_COPY_DEFINE(Int8, int8_t)
+    MAPPEDFILE_COPY_DEFINE(UInt8, uint8_t)
+    BINARYIO_TYPE_MAP(MAPPEDFILE_COPY_DEFINE)
+
+#undef MAPPEDFILE_COPY_DEFINE
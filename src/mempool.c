@@ -1,5 +1,7 @@
 #include "mempool.h"
+#include "bitops.h"
 #include <stdalign.h>
+#include <string.h>
 
 bool mp_init(
     MemoryPool *pool, 
@@ -9,7 +11,7 @@ bool mp_init(
     size_t blockCount,
     size_t *roundedBlockSize
 ) {
-    if (!pool || !buf || blockSize < sizeof(void*) || bufSize < blockSize * blockCount) {
+    if (!pool || !buf || blockSize < sizeof(void*)) {
         return false;
     }
 
@@ -17,42 +19,136 @@ bool mp_init(
 
     // round up blockSize to prevent alignment issues
     size_t alignedSize = (blockSize + align - 1) & ~(align - 1);
+    if (alignedSize < blockSize || (blockCount && bufSize / blockCount < alignedSize)) {
+        return false; // the rounded blocks must fit in buf
+    }
 
+    // O(1): blocks are carved off the front of buf as they are first needed, so none of it is
+    // touched (or faulted in) here; the free list only ever holds blocks given back
     pool->buf = buf;
     pool->blockSize = alignedSize;
     pool->blockCount = blockCount;
+    pool->carved = 0;
+    pool->liveBlocks = 0;
     pool->freeList = NULL;
     pool->initialized = true;
+#ifdef MEMPOOL_STATS
+    pool->totalAllocs = 0;
+    pool->totalFrees = 0;
+    pool->failedAllocs = 0;
+#endif
+#ifdef MEMPOOL_DEBUG
+    pool->occupancy = NULL;
+    pool->onError = NULL;
+    pool->errors = 0;
+#endif
+
+    if (roundedBlockSize) { // optionally return the rounded block size
+        *roundedBlockSize = alignedSize;
+    }
 
-    // abuse pointers horrifically
-    unsigned char *p = (unsigned char*)buf;
+    return true;
+}
 
-    for (size_t i = 0; i < blockCount; ++i) {
-        void *block = p + (i * alignedSize);
-        // store in each block the pointer to the next block
-        *(void **)block = pool->freeList;
-        pool->freeList = block;
+#ifdef MEMPOOL_DEBUG
+static void mp_report(MemoryPool *pool, MemoryPoolError error, void *ptr) {
+    pool->errors++;
+    if (pool->onError) {
+        pool->onError(pool, error, ptr);
     }
+}
 
-    if (roundedBlockSize) { // optionally return the rounded block size
-        *roundedBlockSize = alignedSize;
+static void mp_setLive(MemoryPool *pool, size_t index, bool live) {
+    if (pool->occupancy) {
+        const uint64_t bit = (uint64_t)1 << (index % 64);
+        pool->occupancy[index / 64] = live ? pool->occupancy[index / 64] | bit : pool->occupancy[index / 64] & ~bit;
     }
+}
 
+// whether ptr is a live block of the pool; reports it if not
+static bool mp_checkFree(MemoryPool *pool, void *ptr) {
+    // compare as integers: ptr may point into some other object entirely
+    const uintptr_t offset = (uintptr_t)ptr - (uintptr_t)pool->buf;
+    if ((uintptr_t)ptr < (uintptr_t)pool->buf || offset >= pool->carved * pool->blockSize ||
+        offset % pool->blockSize != 0) {
+        mp_report(pool, MEMPOOL_FOREIGN_POINTER, ptr);
+        return false;
+    }
+    const size_t index = offset / pool->blockSize;
+    if (pool->occupancy && !(pool->occupancy[index / 64] >> (index % 64) & 1)) {
+        mp_report(pool, MEMPOOL_DOUBLE_FREE, ptr);
+        return false;
+    }
+    mp_setLive(pool, index, false);
+    return true;
+}
+
+// the poison written by mp_free (past the free-list link) must be intact
+static void mp_checkPoison(MemoryPool *pool, unsigned char *block) {
+    for (size_t i = sizeof(void *); i < pool->blockSize; ++i) {
+        if (block[i] != MEMPOOL_POISON) {
+            mp_report(pool, MEMPOOL_USE_AFTER_FREE, block);
+            return;
+        }
+    }
+}
+
+bool mp_debugInit(MemoryPool *pool, uint64_t *bitmap, size_t bitmapWords, MemoryPoolErrorHandler onError) {
+    if (!pool || !pool->initialized || !bitmap || bitmapWords < MEMPOOL_BITMAP_WORDS(pool->blockCount) ||
+        pool->carved != 0) {
+        return false;
+    }
+    memset(bitmap, 0, MEMPOOL_BITMAP_WORDS(pool->blockCount) * sizeof(uint64_t));
+    pool->occupancy = bitmap;
+    pool->onError = onError;
     return true;
 }
 
+size_t mp_forEachLive(const MemoryPool *pool, void (*visit)(void *block, void *ctx), void *ctx) {
+    if (!pool || !pool->initialized || !pool->occupancy || !visit) {
+        return 0;
+    }
+    size_t visited = 0;
+    for (size_t w = 0; w < MEMPOOL_BITMAP_WORDS(pool->carved); ++w) {
+        for (uint64_t bits = pool->occupancy[w]; bits; bits &= bits - 1) {
+            visit(pool->buf + (w * 64 + bitops_ctz_uint64_t(bits)) * pool->blockSize, ctx);
+            visited++;
+        }
+    }
+    return visited;
+}
+#endif
+
 void* mp_alloc(MemoryPool *pool) {
-    if (!pool || !pool->initialized || !pool->freeList) {
+    if (!pool || !pool->initialized) {
         return NULL;
     }
     
     void *block = pool->freeList;
     if (block == NULL) {
-        return NULL; // no free blocks
+        if (pool->carved == pool->blockCount) {
+#ifdef MEMPOOL_STATS
+            pool->failedAllocs++;
+#endif
+            return NULL; // no free blocks
+        }
+        // nothing given back yet: take the next never-used block
+        block = pool->buf + pool->carved++ * pool->blockSize;
+    } else {
+#ifdef MEMPOOL_DEBUG
+        mp_checkPoison(pool, block);
+#endif
+        // dereference pointer to next block
+        pool->freeList = *(void **)block; // effectively a "pop"
     }
 
-    // dereference pointer to next block
-    pool->freeList = *(void **)block; // effectively a "pop"
+    pool->liveBlocks++;
+#ifdef MEMPOOL_STATS
+    pool->totalAllocs++;
+#endif
+#ifdef MEMPOOL_DEBUG
+    mp_setLive(pool, (size_t)((unsigned char *)block - pool->buf) / pool->blockSize, true);
+#endif
     return block;
 }
 
@@ -61,29 +157,153 @@ void mp_free(MemoryPool *pool, void *ptr) {
         return;
     }
 
+#ifdef MEMPOOL_DEBUG
+    if (!mp_checkFree(pool, ptr)) {
+        return; // reported; leave the free list intact
+    }
+    memset((unsigned char *)ptr + sizeof(void *), MEMPOOL_POISON, pool->blockSize - sizeof(void *));
+#endif
+
     // write the pointer to freeList in the block
     *(void **)ptr = pool->freeList; // effectively a "push"
     pool->freeList = ptr;
+    pool->liveBlocks--;
+#ifdef MEMPOOL_STATS
+    pool->totalFrees++;
+#endif
 }
 
 size_t mp_openBlocks(const MemoryPool *pool) {
     if (!pool || !pool->initialized) {
         return 0;
     }
+    return pool->blockCount - pool->liveBlocks;
+}
 
-    size_t count = 0;
-    void *node = pool->freeList;
+bool mp_isEmpty(const MemoryPool *pool) {
+    if (!pool || !pool->initialized) {
+        return true;
+    }
+    return pool->liveBlocks == pool->blockCount;
+}
 
-    while (node) {
-        count++;
-        node = *(void **)node;
+MemoryPoolStats mp_stats(const MemoryPool *pool) {
+    MemoryPoolStats stats = { 0 };
+    if (!pool || !pool->initialized) {
+        return stats;
     }
-    return count;
+    stats.capacity = pool->blockCount;
+    stats.live = pool->liveBlocks;
+    stats.free = pool->blockCount - pool->liveBlocks;
+    // blocks are only carved when every carved block is live, so carved is the peak live count
+    stats.highWater = pool->carved;
+#ifdef MEMPOOL_STATS
+    stats.allocs = pool->totalAllocs;
+    stats.frees = pool->totalFrees;
+    stats.failedAllocs = pool->failedAllocs;
+#endif
+#ifdef MEMPOOL_DEBUG
+    stats.errors = pool->errors;
+#endif
+    return stats;
 }
 
-bool mp_isEmpty(const MemoryPool *pool) {
+#define AMP_INDEX(head) ((uint32_t)(head))
+#define AMP_PACK(tag, index) ((uint64_t)(tag) << 32 | (uint32_t)(index))
+
+// the first bytes of a free block hold the (index + 1) of the next free block
+static inline atomic_uint_least32_t *amp_link(const AtomicMemoryPool *pool, uint32_t index) {
+    return (atomic_uint_least32_t *)(pool->buf + (size_t)(index - 1) * pool->blockSize);
+}
+
+bool amp_init(
+    AtomicMemoryPool *pool,
+    void *buf,
+    size_t bufSize,
+    size_t blockSize,
+    size_t blockCount,
+    size_t *roundedBlockSize
+) {
+    if (!pool || !buf || blockSize < sizeof(atomic_uint_least32_t) || blockCount >= UINT32_MAX) {
+        return false;
+    }
+
+    size_t align = alignof(void*);
+    size_t alignedSize = (blockSize + align - 1) & ~(align - 1);
+    if (alignedSize < blockSize || (blockCount && bufSize / blockCount < alignedSize)) {
+        return false;
+    }
+
+    pool->buf = buf;
+    pool->blockSize = alignedSize;
+    pool->blockCount = blockCount;
+
+    // link the blocks in address order so a fresh pool hands them out sequentially
+    for (size_t i = 1; i <= blockCount; ++i) {
+        atomic_init(amp_link(pool, (uint32_t)i), i < blockCount ? (uint32_t)(i + 1) : 0);
+    }
+    atomic_init(&pool->head, AMP_PACK(0, blockCount ? 1 : 0));
+    atomic_init(&pool->freeBlocks, blockCount);
+    pool->initialized = true;
+
+    if (roundedBlockSize) {
+        *roundedBlockSize = alignedSize;
+    }
+
+    return true;
+}
+
+void* amp_alloc(AtomicMemoryPool *pool) {
+    if (!pool || !pool->initialized) {
+        return NULL;
+    }
+
+    // acquire pairs with the release in amp_free, so the link read below is the one it wrote
+    uint64_t head = atomic_load_explicit(&pool->head, memory_order_acquire);
+    for (;;) {
+        uint32_t index = AMP_INDEX(head);
+        if (index == 0) {
+            return NULL; // no free blocks
+        }
+        // may be stale if another thread pops this block first; the tag makes the swap fail then
+        uint32_t next = atomic_load_explicit(amp_link(pool, index), memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(&pool->head, &head, AMP_PACK((head >> 32) + 1, next),
+                                                  memory_order_acquire, memory_order_acquire)) {
+            atomic_fetch_sub_explicit(&pool->freeBlocks, 1, memory_order_relaxed);
+            return pool->buf + (size_t)(index - 1) * pool->blockSize;
+        }
+    }
+}
+
+void amp_free(AtomicMemoryPool *pool, void *ptr) {
+    if (!pool || !pool->initialized || !ptr) {
+        return;
+    }
+
+    uint32_t index = (uint32_t)(((unsigned char *)ptr - pool->buf) / pool->blockSize) + 1;
+    uint64_t head = atomic_load_explicit(&pool->head, memory_order_relaxed);
+    do {
+        atomic_store_explicit(amp_link(pool, index), AMP_INDEX(head), memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(&pool->head, &head, AMP_PACK((head >> 32) + 1, index),
+                                                    memory_order_release, memory_order_relaxed));
+    atomic_fetch_add_explicit(&pool->freeBlocks, 1, memory_order_relaxed);
+}
+
+size_t amp_openBlocks(const AtomicMemoryPool *pool) {
+    if (!pool || !pool->initialized) {
+        return 0;
+    }
+    // the counter trails the stack by a moment, so it can briefly step outside [0, blockCount]
+    size_t count = atomic_load_explicit(&((AtomicMemoryPool *)pool)->freeBlocks, memory_order_relaxed);
+    if (count > SIZE_MAX / 2) {
+        return 0;
+    }
+    return count > pool->blockCount ? pool->blockCount : count;
+}
+
+bool amp_isEmpty(const AtomicMemoryPool *pool) {
     if (!pool || !pool->initialized) {
         return true;
     }
-    return pool->freeList == NULL;
-}
\ No newline at end of file
+    return AMP_INDEX(atomic_load_explicit(&((AtomicMemoryPool *)pool)->head, memory_order_acquire)) == 0;
+}
@@ -0,0 +1,55 @@
+/*!
+ * \file once.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Internal helper for building lookup tables exactly once, from any thread.
+ * \remarks Not part of the public API. With C11 threads this is call_once. Without them, a
+ * compare-exchange on an unbuilt/building/built state lets exactly one caller run the
+ * initializer while any others wait for it to finish, so no two threads write the tables at once.
+ *
+ * \version 0.1
+ * \date 2026-10-17
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CMOR_ONCE_H
+#define CMOR_ONCE_H
+
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+
+typedef once_flag CmorOnce; //!< flag for \ref cmor_once; static, initialized with CMOR_ONCE_INIT
+#define CMOR_ONCE_INIT ONCE_FLAG_INIT
+
+/*! \brief Runs init the first time any thread passes flag; later callers return once it has finished. */
+static inline void cmor_once(CmorOnce *flag, void (*init)(void)) {
+    call_once(flag, init);
+}
+#else
+#include <stdatomic.h>
+
+typedef atomic_int CmorOnce; //!< flag for \ref cmor_once; static, initialized with CMOR_ONCE_INIT
+#define CMOR_ONCE_INIT 0
+
+enum { CMOR_ONCE_UNBUILT = 0, CMOR_ONCE_BUILDING, CMOR_ONCE_BUILT };
+
+/*! \brief Runs init the first time any thread passes flag; later callers return once it has finished. */
+static inline void cmor_once(CmorOnce *flag, void (*init)(void)) {
+    if (atomic_load_explicit(flag, memory_order_acquire) == CMOR_ONCE_BUILT) {
+        return;
+    }
+    int expected = CMOR_ONCE_UNBUILT;
+    if (atomic_compare_exchange_strong_explicit(flag, &expected, CMOR_ONCE_BUILDING, memory_order_acquire,
+                                                memory_order_acquire)) {
+        init();
+        atomic_store_explicit(flag, CMOR_ONCE_BUILT, memory_order_release);
+        return;
+    }
+    while (atomic_load_explicit(flag, memory_order_acquire) != CMOR_ONCE_BUILT) {
+        // another thread is building; the tables are small, so it will not be long
+    }
+}
+#endif
+
+#endif // CMOR_ONCE_H
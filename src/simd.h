@@ -0,0 +1,62 @@
+/*!
+ * \file simd.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Internal helpers for runtime selection of vectorized kernels.
+ * \remarks Not part of the public API. Kernels are compiled for their instruction set with
+ * \ref CMOR_TARGET so the library itself still builds for the baseline architecture,
+ * and each public function picks a kernel from \ref simd_level at run time.
+ *
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CMOR_SIMD_H
+#define CMOR_SIMD_H
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#include <stdatomic.h>
+#define CMOR_X86_SIMD 1
+#define CMOR_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CMOR_X86_SIMD 0
+#endif
+
+#if CMOR_X86_SIMD
+/*! Instruction set extensions the kernels can be dispatched to, in increasing order. */
+typedef enum {
+    SIMD_NONE = 0,
+    SIMD_SSSE3,
+    SIMD_AVX2,
+    SIMD_AVX512
+} SimdLevel;
+
+/*!
+ * \brief Detects the widest usable vector extension once and caches it.
+ * \remarks Concurrent first calls race benignly; they all store the same value.
+ */
+static inline SimdLevel simd_level(void) {
+    static atomic_int cached = -1;
+    int level = atomic_load_explicit(&cached, memory_order_relaxed);
+    if (level < 0) {
+        __builtin_cpu_init();
+        level = SIMD_NONE;
+        if (__builtin_cpu_supports("ssse3")) {
+            level = SIMD_SSSE3;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            level = SIMD_AVX2;
+        }
+        if (__builtin_cpu_supports("avx512f")) {
+            level = SIMD_AVX512;
+        }
+        atomic_store_explicit(&cached, level, memory_order_relaxed);
+    }
+    return (SimdLevel)level;
+}
+#endif // CMOR_X86_SIMD
+
+#endif // CMOR_SIMD_H
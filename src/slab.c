@@ -0,0 +1,309 @@
+/*!
+ * \file slab.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Provides function implementations for the slab allocator.
+ * \version 0.1
+ * \date 2026-10-17
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#define _DEFAULT_SOURCE // mmap with MAP_ANONYMOUS, which strict POSIX modes of glibc hide
+
+#include "slab.h"
+#include "bitops.h"
+#include "mempool.h"
+#include <stdalign.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#include <sys/mman.h>
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+#ifdef MAP_ANONYMOUS
+#define SLAB_MMAP 1
+#else
+#define SLAB_MMAP 0
+#endif
+
+#ifndef SLAB_CHUNK_SIZE
+#define SLAB_CHUNK_SIZE ((size_t)1 << 20) //!< bytes per chunk, a power of two; set it when building the library
+#endif
+
+_Static_assert((SLAB_CHUNK_SIZE & (SLAB_CHUNK_SIZE - 1)) == 0, "SLAB_CHUNK_SIZE must be a power of two");
+_Static_assert(SLAB_MAX_SMALL <= SLAB_CHUNK_SIZE / 8, "a chunk should hold several of the largest blocks");
+
+#define SLAB_LARGE SLAB_CLASS_COUNT //!< sizeClass of a mapping holding a single large allocation
+
+/*! Header at the start of every mapping, found from any pointer into it by masking */
+struct SlabChunk {
+    MemoryPool pool; //!< blocks of the chunk's size class; unused for large allocations
+    SlabChunk *prev; //!< neighbours in the list the chunk is on
+    SlabChunk *next;
+    size_t mapSize; //!< bytes mapped
+    unsigned sizeClass; //!< index into the size classes, or SLAB_LARGE
+};
+
+// blocks start this far into a chunk; a multiple of max_align_t keeps them aligned like malloc's
+#define SLAB_HEADER ((sizeof(SlabChunk) + 63) & ~(size_t)63)
+_Static_assert(SLAB_HEADER % alignof(max_align_t) == 0, "blocks must be aligned for any type");
+
+static SlabChunk *chunk_of(const void *ptr) {
+    return (SlabChunk *)((uintptr_t)ptr & ~(uintptr_t)(SLAB_CHUNK_SIZE - 1));
+}
+
+/*! \brief Size class serving size bytes: 16-byte steps to 128, then four per power of two. */
+static unsigned size_class(size_t size) {
+    if (size <= 128) {
+        return size ? (unsigned)((size + 15) / 16 - 1) : 0;
+    }
+    const unsigned lg = bitops_log2Floor_uint64_t((uint64_t)(size - 1));
+    return 8 + (lg - 7) * 4 + (unsigned)((size - 1) >> (lg - 2)) - 4;
+}
+
+static size_t class_size(unsigned sizeClass) {
+    if (sizeClass < 8) {
+        return (size_t)(sizeClass + 1) * 16;
+    }
+    const unsigned k = sizeClass - 8, lg = 7 + k / 4;
+    return ((size_t)1 << lg) + (size_t)(k % 4 + 1) * ((size_t)1 << (lg - 2));
+}
+
+static void list_push(SlabChunk **head, SlabChunk *c) {
+    c->prev = NULL;
+    c->next = *head;
+    if (*head) {
+        (*head)->prev = c;
+    }
+    *head = c;
+}
+
+static void list_remove(SlabChunk **head, SlabChunk *c) {
+    if (c->prev) {
+        c->prev->next = c->next;
+    } else {
+        *head = c->next;
+    }
+    if (c->next) {
+        c->next->prev = c->prev;
+    }
+}
+
+#if SLAB_MMAP
+static size_t page_size(void) {
+    const long page = sysconf(_SC_PAGESIZE);
+    return page > 0 ? (size_t)page : 4096;
+}
+
+/*! \brief Maps len bytes (a multiple of the page size) starting on a SLAB_CHUNK_SIZE boundary. */
+static SlabChunk *chunk_map(size_t len) {
+    // over-map by a chunk, then unmap the unaligned head and the excess tail
+    unsigned char *raw = mmap(NULL, len + SLAB_CHUNK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return NULL;
+    }
+    unsigned char *base = (unsigned char *)(((uintptr_t)raw + SLAB_CHUNK_SIZE - 1) & ~(uintptr_t)(SLAB_CHUNK_SIZE - 1));
+    if (base > raw) {
+        munmap(raw, (size_t)(base - raw));
+    }
+    const size_t tail = (size_t)(raw + len + SLAB_CHUNK_SIZE - (base + len));
+    if (tail > 0) {
+        munmap(base + len, tail);
+    }
+    SlabChunk *c = (SlabChunk *)base;
+    c->mapSize = len;
+    return c;
+}
+
+static void chunk_unmap(SlabAllocator *slab, SlabChunk *c) {
+    slab->mappedBytes -= c->mapSize;
+    munmap(c, c->mapSize);
+}
+#else
+static SlabChunk *chunk_map(size_t len) {
+    (void)len;
+    return NULL;
+}
+
+static void chunk_unmap(SlabAllocator *slab, SlabChunk *c) {
+    (void)slab;
+    (void)c;
+}
+#endif
+
+bool slab_init(SlabAllocator *slab) {
+    if (!slab) {
+        return false;
+    }
+    memset(slab, 0, sizeof *slab);
+#if SLAB_MMAP
+    slab->initialized = page_size() <= SLAB_CHUNK_SIZE;
+#endif
+    return slab->initialized;
+}
+
+void slab_destroy(SlabAllocator *slab) {
+    if (!slab || !slab->initialized) {
+        return;
+    }
+    for (unsigned i = 0; i < SLAB_CLASS_COUNT; ++i) {
+        while (slab->partial[i]) {
+            SlabChunk *c = slab->partial[i];
+            slab->partial[i] = c->next;
+            chunk_unmap(slab, c);
+        }
+    }
+    SlabChunk **lists[] = { &slab->full, &slab->large };
+    for (size_t i = 0; i < sizeof lists / sizeof lists[0]; ++i) {
+        while (*lists[i]) {
+            SlabChunk *c = *lists[i];
+            *lists[i] = c->next;
+            chunk_unmap(slab, c);
+        }
+    }
+    slab->initialized = false;
+}
+
+static void *alloc_large(SlabAllocator *slab, size_t size) {
+#if SLAB_MMAP
+    const size_t page = page_size();
+    if (size > SIZE_MAX - SLAB_HEADER - SLAB_CHUNK_SIZE - page) {
+        return NULL;
+    }
+    SlabChunk *c = chunk_map((SLAB_HEADER + size + page - 1) & ~(page - 1));
+    if (!c) {
+        return NULL;
+    }
+    c->sizeClass = SLAB_LARGE;
+    slab->mappedBytes += c->mapSize;
+    list_push(&slab->large, c);
+    return (unsigned char *)c + SLAB_HEADER;
+#else
+    (void)slab;
+    (void)size;
+    return NULL;
+#endif
+}
+
+void *slab_alloc(SlabAllocator *slab, size_t size) {
+    if (!slab || !slab->initialized) {
+        return NULL;
+    }
+    if (size > SLAB_MAX_SMALL) {
+        return alloc_large(slab, size);
+    }
+
+    const unsigned sizeClass = size_class(size);
+    SlabChunk *c = slab->partial[sizeClass];
+    if (!c) {
+        c = chunk_map(SLAB_CHUNK_SIZE);
+        if (!c) {
+            return NULL;
+        }
+        // O(1) however many blocks fit: the pool carves them as they are first used
+        const size_t blockSize = class_size(sizeClass);
+        mp_init(&c->pool, (unsigned char *)c + SLAB_HEADER, SLAB_CHUNK_SIZE - SLAB_HEADER, blockSize,
+                (SLAB_CHUNK_SIZE - SLAB_HEADER) / blockSize, NULL);
+        c->sizeClass = sizeClass;
+        slab->mappedBytes += c->mapSize;
+        list_push(&slab->partial[sizeClass], c);
+    }
+
+    void *block = mp_alloc(&c->pool);
+    if (mp_isEmpty(&c->pool)) {
+        list_remove(&slab->partial[sizeClass], c);
+        list_push(&slab->full, c);
+    }
+    return block;
+}
+
+void *slab_calloc(SlabAllocator *slab, size_t count, size_t size) {
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *p = slab_alloc(slab, count * size);
+    if (p && count * size <= SLAB_MAX_SMALL) {
+        memset(p, 0, count * size); // fresh mappings are already zero
+    }
+    return p;
+}
+
+void slab_free(SlabAllocator *slab, void *ptr) {
+    if (!slab || !slab->initialized || !ptr) {
+        return;
+    }
+    SlabChunk *c = chunk_of(ptr);
+    if (c->sizeClass == SLAB_LARGE) {
+        list_remove(&slab->large, c);
+        chunk_unmap(slab, c);
+        return;
+    }
+
+    SlabChunk **partial = &slab->partial[c->sizeClass];
+    if (mp_isEmpty(&c->pool)) { // was full; it has room again
+        list_remove(&slab->full, c);
+        list_push(partial, c);
+    }
+    mp_free(&c->pool, ptr);
+
+    // give an unused chunk back, keeping one per class so alloc/free at a boundary cannot thrash
+    if (mp_openBlocks(&c->pool) == c->pool.blockCount && (c->prev || c->next)) {
+        list_remove(partial, c);
+        chunk_unmap(slab, c);
+    }
+}
+
+size_t slab_usableSize(const void *ptr) {
+    if (!ptr) {
+        return 0;
+    }
+    const SlabChunk *c = chunk_of(ptr);
+    return c->sizeClass == SLAB_LARGE ? c->mapSize - SLAB_HEADER : c->pool.blockSize;
+}
+
+void *slab_realloc(SlabAllocator *slab, void *ptr, size_t size) {
+    if (!ptr) {
+        return slab_alloc(slab, size);
+    }
+    if (size == 0) {
+        slab_free(slab, ptr);
+        return NULL;
+    }
+
+    // stay put while the size class is unchanged, or for a large block while at least half is used
+    const size_t usable = slab_usableSize(ptr);
+    if (size <= usable && (usable <= SLAB_MAX_SMALL ? size_class(size) == chunk_of(ptr)->sizeClass : size > usable / 2)) {
+        return ptr;
+    }
+
+    void *moved = slab_alloc(slab, size);
+    if (moved) {
+        memcpy(moved, ptr, size < usable ? size : usable);
+        slab_free(slab, ptr);
+    }
+    return moved;
+}
+
+void slab_trim(SlabAllocator *slab) {
+    if (!slab || !slab->initialized) {
+        return;
+    }
+    for (unsigned i = 0; i < SLAB_CLASS_COUNT; ++i) {
+        for (SlabChunk *c = slab->partial[i], *next; c; c = next) {
+            next = c->next;
+            if (mp_openBlocks(&c->pool) == c->pool.blockCount) {
+                list_remove(&slab->partial[i], c);
+                chunk_unmap(slab, c);
+            }
+        }
+    }
+}
@@ -0,0 +1,603 @@
+/*!
+ * \file textcodec.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Provides function implementations for the hex and Base64 codecs.
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "textcodec.h"
+#include "once.h"
+#include "simd.h"
+#include <string.h>
+
+static const char hex_digits[2][17] = { "0123456789abcdef", "0123456789ABCDEF" };
+
+static const char base64_alphabet[2][65] = {
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+};
+
+/*! Value of each character plus one per alphabet; 0 marks characters outside it (padding included). */
+static uint8_t base64_values[2][256];
+
+static void base64_build_tables(void) {
+    for (unsigned v = 0; v < 2; ++v) {
+        for (unsigned i = 0; i < 64; ++i) {
+            base64_values[v][(unsigned char)base64_alphabet[v][i]] = (uint8_t)(i + 1);
+        }
+    }
+}
+
+static void base64_init_tables(void) {
+    static CmorOnce once = CMOR_ONCE_INIT;
+    cmor_once(&once, base64_build_tables);
+}
+
+static int hex_value(unsigned char c) {
+    const unsigned digit = (unsigned)c - '0';
+    const unsigned letter = (unsigned)(c | 0x20) - 'a';
+    if (digit < 10) {
+        return (int)digit;
+    }
+    return letter < 6 ? (int)letter + 10 : -1;
+}
+
+#if CMOR_X86_SIMD
+/*!
+ * \brief Hex kernels: 32 bytes become 64 digits through one pshufb table lookup per nibble;
+ * decoding range-checks each character, then pmaddubsw joins digit pairs into bytes.
+ * Each returns how much of its input it handled; the decoder stops before a block with a bad character.
+ */
+CMOR_TARGET("avx2") static size_t hex_encode_avx2(const uint8_t *src, size_t len, char *out, const char digits[16]) {
+    const __m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)digits));
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        const __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low);
+        const __m256i lo = _mm256_and_si256(v, low);
+        // unpack works within 128-bit lanes, so a holds bytes 0-7 and 16-23, b bytes 8-15 and 24-31
+        const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+        const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256((__m256i *)(out + 2 * i), _mm256_shuffle_epi8(table, _mm256_permute2x128_si256(a, b, 0x20)));
+        _mm256_storeu_si256((__m256i *)(out + 2 * i + 32), _mm256_shuffle_epi8(table, _mm256_permute2x128_si256(a, b, 0x31)));
+    }
+    return i;
+}
+
+CMOR_TARGET("avx2") static inline __m256i hex_nibbles_avx2(__m256i c, int *valid) {
+    const __m256i digit = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+    const __m256i letter = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const __m256i isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    const __m256i isLetter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+    *valid = _mm256_movemask_epi8(_mm256_or_si256(isDigit, isLetter)) == -1;
+    return _mm256_blendv_epi8(_mm256_add_epi8(letter, _mm256_set1_epi8(10)), digit, isDigit);
+}
+
+CMOR_TARGET("avx2") static size_t hex_decode_avx2(const char *in, size_t len, uint8_t *out) {
+    const __m256i weights = _mm256_set1_epi16(0x0110); // 16 * first digit + second digit
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        int valid0, valid1;
+        const __m256i v0 = hex_nibbles_avx2(_mm256_loadu_si256((const __m256i *)(in + i)), &valid0);
+        const __m256i v1 = hex_nibbles_avx2(_mm256_loadu_si256((const __m256i *)(in + i + 32)), &valid1);
+        if (!(valid0 & valid1)) {
+            break;
+        }
+        const __m256i bytes = _mm256_packus_epi16(_mm256_maddubs_epi16(v0, weights), _mm256_maddubs_epi16(v1, weights));
+        _mm256_storeu_si256((__m256i *)(out + i / 2), _mm256_permute4x64_epi64(bytes, 0xD8));
+    }
+    return i;
+}
+
+/*!
+ * \brief Base64 kernels after Muła and Lemire: 24 bytes are spread into 32 six-bit indices with one
+ * shuffle and two multiplies, and mapped to characters by adding a per-range offset picked with pshufb.
+ * Decoding range-checks each character (so both alphabets share the code), adds the offset that
+ * turns it into its value, and packs four values into three bytes with pmaddubsw and pmaddwd.
+ */
+CMOR_TARGET("avx2") static size_t base64_encode_avx2(const uint8_t *src, size_t len, char *out, Base64Variant variant) {
+    const char c62 = base64_alphabet[variant][62], c63 = base64_alphabet[variant][63];
+    const __m256i spread = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, (char)(c62 - 62), (char)(c63 - 63), 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, (char)(c62 - 62), (char)(c63 - 63), 'A', 0, 0);
+    size_t i = 0, o = 0;
+    // each step loads 16 bytes at i + 12, so 28 bytes must be readable for 24 consumed
+    for (; i + 28 <= len; i += 24, o += 32) {
+        const __m128i lo = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i hi = _mm_loadu_si128((const __m128i *)(src + i + 12));
+        const __m256i v = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), spread);
+        const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(v, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(t0, t1);
+        // 0-25 -> 13, 26-51 -> 0, 52-61 -> 1-10, 62 -> 11, 63 -> 12
+        __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+        _mm256_storeu_si256((__m256i *)(out + o), _mm256_add_epi8(_mm256_shuffle_epi8(offsets, range), indices));
+    }
+    return i;
+}
+
+CMOR_TARGET("avx2") static inline __m256i base64_in_range(__m256i c, char first, char span) {
+    const __m256i rel = _mm256_sub_epi8(c, _mm256_set1_epi8(first));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(rel, _mm256_set1_epi8(span)), rel);
+}
+
+CMOR_TARGET("avx2") static size_t base64_decode_avx2(const char *in, size_t len, uint8_t *out, Base64Variant variant) {
+    const char c62 = base64_alphabet[variant][62], c63 = base64_alphabet[variant][63];
+    const __m256i gather = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    size_t i = 0, o = 0;
+    for (; i + 32 <= len; i += 32, o += 24) {
+        const __m256i c = _mm256_loadu_si256((const __m256i *)(in + i));
+        const __m256i upper = base64_in_range(c, 'A', 25);
+        const __m256i lower = base64_in_range(c, 'a', 25);
+        const __m256i digit = base64_in_range(c, '0', 9);
+        const __m256i is62 = _mm256_cmpeq_epi8(c, _mm256_set1_epi8(c62));
+        const __m256i is63 = _mm256_cmpeq_epi8(c, _mm256_set1_epi8(c63));
+        const __m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, _mm256_or_si256(is62, is63)));
+        if (_mm256_movemask_epi8(valid) != -1) {
+            break;
+        }
+        __m256i shift = _mm256_and_si256(upper, _mm256_set1_epi8(-'A'));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a')));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(is62, _mm256_set1_epi8((char)(62 - c62))));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(is63, _mm256_set1_epi8((char)(63 - c63))));
+        const __m256i values = _mm256_add_epi8(c, shift);
+        // (a, b, c, d) -> (a << 6 | b, c << 6 | d) -> a << 18 | b << 12 | c << 6 | d in each 32-bit lane
+        const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        const __m256i words = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(words, gather), compact);
+        _mm_storeu_si128((__m128i *)(out + o), _mm256_castsi256_si128(bytes));
+        _mm_storel_epi64((__m128i *)(out + o + 16), _mm256_extracti128_si256(bytes, 1));
+    }
+    return i;
+}
+#endif // CMOR_X86_SIMD
+
+static void hex_encode_all(const uint8_t *src, size_t len, char *out, bool upper) {
+    const char *digits = hex_digits[upper];
+    size_t i = 0;
+#if CMOR_X86_SIMD
+    if (simd_level() >= SIMD_AVX2) {
+        i = hex_encode_avx2(src, len, out, digits);
+    }
+#endif
+    for (; i < len; ++i) {
+        out[2 * i] = digits[src[i] >> 4];
+        out[2 * i + 1] = digits[src[i] & 0x0F];
+    }
+}
+
+/*! \brief Decodes len (even) digits; false if any is not a hex digit. */
+static bool hex_decode_pairs(const char *in, size_t len, uint8_t *out) {
+    size_t i = 0;
+#if CMOR_X86_SIMD
+    if (simd_level() >= SIMD_AVX2) {
+        i = hex_decode_avx2(in, len, out);
+    }
+#endif
+    for (; i < len; i += 2) {
+        const int hi = hex_value((unsigned char)in[i]);
+        const int lo = hex_value((unsigned char)in[i + 1]);
+        if (hi < 0 || lo < 0) {
+            return false;
+        }
+        out[i / 2] = (uint8_t)(hi << 4 | lo);
+    }
+    return true;
+}
+
+/*! \brief Encodes len bytes, a multiple of three, without padding; returns the characters written. */
+static size_t base64_encode_groups(const uint8_t *src, size_t len, char *out, Base64Variant variant) {
+    const char *alphabet = base64_alphabet[variant];
+    size_t i = 0;
+#if CMOR_X86_SIMD
+    if (simd_level() >= SIMD_AVX2) {
+        i = base64_encode_avx2(src, len, out, variant);
+    }
+#endif
+    size_t o = i / 3 * 4;
+    for (; i < len; i += 3, o += 4) {
+        const uint32_t v = (uint32_t)src[i] << 16 | (uint32_t)src[i + 1] << 8 | src[i + 2];
+        out[o] = alphabet[v >> 18];
+        out[o + 1] = alphabet[(v >> 12) & 0x3F];
+        out[o + 2] = alphabet[(v >> 6) & 0x3F];
+        out[o + 3] = alphabet[v & 0x3F];
+    }
+    return o;
+}
+
+/*! \brief Encodes the final one or two bytes, padded for the standard variant; returns the characters written. */
+static size_t base64_encode_tail(const uint8_t *src, size_t len, char *out, Base64Variant variant) {
+    const char *alphabet = base64_alphabet[variant];
+    const uint32_t v = (uint32_t)src[0] << 16 | (len > 1 ? (uint32_t)src[1] << 8 : 0);
+    size_t o = 0;
+    out[o++] = alphabet[v >> 18];
+    out[o++] = alphabet[(v >> 12) & 0x3F];
+    if (len > 1) {
+        out[o++] = alphabet[(v >> 6) & 0x3F];
+    }
+    while (variant == BASE64_STANDARD && o < 4) {
+        out[o++] = '=';
+    }
+    return o;
+}
+
+/*! \brief Decodes len characters, a multiple of four, without padding; false on any character outside the alphabet. */
+static bool base64_decode_groups(const char *in, size_t len, uint8_t *out, Base64Variant variant) {
+    const uint8_t *values = base64_values[variant];
+    size_t i = 0;
+#if CMOR_X86_SIMD
+    if (simd_level() >= SIMD_AVX2) {
+        i = base64_decode_avx2(in, len, out, variant);
+    }
+#endif
+    for (size_t o = i / 4 * 3; i < len; i += 4, o += 3) {
+        const unsigned a = values[(unsigned char)in[i]], b = values[(unsigned char)in[i + 1]];
+        const unsigned c = values[(unsigned char)in[i + 2]], d = values[(unsigned char)in[i + 3]];
+        if (!a || !b || !c || !d) {
+            return false;
+        }
+        const uint32_t v = (a - 1) << 18 | (b - 1) << 12 | (c - 1) << 6 | (d - 1);
+        out[o] = (uint8_t)(v >> 16);
+        out[o + 1] = (uint8_t)(v >> 8);
+        out[o + 2] = (uint8_t)v;
+    }
+    return true;
+}
+
+/*!
+ * \brief Decodes a final group of two or three significant characters into one or two bytes.
+ * \remarks The bits past the last whole byte must be zero, which rules out alternative spellings of the same bytes.
+ */
+static bool base64_decode_tail(const char *in, size_t chars, uint8_t *out, Base64Variant variant) {
+    const uint8_t *values = base64_values[variant];
+    const unsigned a = values[(unsigned char)in[0]], b = values[(unsigned char)in[1]];
+    const unsigned c = chars > 2 ? values[(unsigned char)in[2]] : 1;
+    if (!a || !b || !c) {
+        return false;
+    }
+    const uint32_t v = (a - 1) << 18 | (b - 1) << 12 | (c - 1) << 6;
+    if (v & (chars > 2 ? 0xFF : 0xFFFF)) {
+        return false;
+    }
+    out[0] = (uint8_t)(v >> 16);
+    if (chars > 2) {
+        out[1] = (uint8_t)(v >> 8);
+    }
+    return true;
+}
+
+/*! \brief Decodes one complete group of four, which may be padded; sets *padded if it was. */
+static bool base64_decode_group(const char group[4], uint8_t *out, size_t *produced, bool *padded, Base64Variant variant) {
+    *padded = group[3] == '=';
+    if (!*padded) {
+        *produced = 3;
+        return base64_decode_groups(group, 4, out, variant);
+    }
+    const size_t chars = group[2] == '=' ? 2 : 3;
+    *produced = chars - 1;
+    return base64_decode_tail(group, chars, out, variant);
+}
+
+TextCodecStatus hex_encode(const uint8_t src[], size_t len, char out[], size_t outSize, bool upper, size_t *written) {
+    size_t n = 0;
+    TextCodecStatus status = TEXTCODEC_SUCCESS;
+    if ((!src && len) || (!out && outSize)) {
+        status = TEXTCODEC_INVALID;
+    } else if (outSize / 2 < len) {
+        status = TEXTCODEC_END;
+    } else if (len) {
+        hex_encode_all(src, len, out, upper);
+        n = 2 * len;
+    }
+    if (written) {
+        *written = n;
+    }
+    return status;
+}
+
+TextCodecStatus hex_decode(const char in[], size_t len, uint8_t out[], size_t outSize, size_t *written) {
+    size_t n = 0;
+    TextCodecStatus status = TEXTCODEC_SUCCESS;
+    if ((!in && len) || (!out && outSize)) {
+        status = TEXTCODEC_INVALID;
+    } else if (len % 2) {
+        status = TEXTCODEC_MALFORMED;
+    } else if (outSize < len / 2) {
+        status = TEXTCODEC_END;
+    } else if (!hex_decode_pairs(in, len, out)) {
+        status = TEXTCODEC_MALFORMED;
+    } else {
+        n = len / 2;
+    }
+    if (written) {
+        *written = n;
+    }
+    return status;
+}
+
+TextCodecStatus base64_encode(const uint8_t src[], size_t len, Base64Variant variant,
+                              char out[], size_t outSize, size_t *written) {
+    size_t n = 0;
+    TextCodecStatus status = TEXTCODEC_SUCCESS;
+    if ((!src && len) || (!out && outSize) || (unsigned)variant > BASE64_URL) {
+        status = TEXTCODEC_INVALID;
+    } else if (outSize < base64_encodedSize(len, variant)) {
+        status = TEXTCODEC_END;
+    } else if (len) {
+        const size_t whole = len / 3 * 3;
+        n = base64_encode_groups(src, whole, out, variant);
+        if (whole < len) {
+            n += base64_encode_tail(src + whole, len - whole, out + n, variant);
+        }
+    }
+    if (written) {
+        *written = n;
+    }
+    return status;
+}
+
+size_t base64_decodedSize(const char in[], size_t len) {
+    size_t size = len / 4 * 3 + (len % 4 ? len % 4 - 1 : 0);
+    if (in && len >= 4 && len % 4 == 0) {
+        size -= (in[len - 1] == '=') + (in[len - 1] == '=' && in[len - 2] == '=');
+    }
+    return size;
+}
+
+TextCodecStatus base64_decode(const char in[], size_t len, Base64Variant variant,
+                              uint8_t out[], size_t outSize, size_t *written) {
+    size_t n = 0;
+    TextCodecStatus status = TEXTCODEC_SUCCESS;
+    if ((!in && len) || (!out && outSize) || (unsigned)variant > BASE64_URL) {
+        status = TEXTCODEC_INVALID;
+    } else if (len % 4 == 1 || (variant == BASE64_STANDARD && len % 4)) {
+        status = TEXTCODEC_MALFORMED;
+    } else if (outSize < base64_decodedSize(in, len)) {
+        status = TEXTCODEC_END;
+    } else if (len) {
+        base64_init_tables();
+        // split off the final group if it is padded or (URL variant) short
+        size_t whole = len / 4 * 4;
+        size_t tail = len % 4;
+        if (!tail && in[len - 1] == '=') {
+            whole -= 4;
+            tail = in[len - 2] == '=' ? 2 : 3;
+        }
+        if (!base64_decode_groups(in, whole, out, variant) ||
+            (tail && !base64_decode_tail(in + whole, tail, out + whole / 4 * 3, variant))) {
+            status = TEXTCODEC_MALFORMED;
+        } else {
+            n = whole / 4 * 3 + (tail ? tail - 1 : 0);
+        }
+    }
+    if (written) {
+        *written = n;
+    }
+    return status;
+}
+
+void hex_decoderInit(HexDecoder *decoder) {
+    if (decoder) {
+        decoder->pending = 0;
+        decoder->hasPending = false;
+    }
+}
+
+TextCodecStatus hex_decoderUpdate(HexDecoder *decoder, const char in[], size_t len,
+                                  uint8_t out[], size_t outSize, size_t *written) {
+    size_t n = 0;
+    TextCodecStatus status = TEXTCODEC_SUCCESS;
+    if (!decoder || (!in && len) || (!out && outSize)) {
+        status = TEXTCODEC_INVALID;
+    } else if (outSize < (decoder->hasPending + len) / 2) {
+        status = TEXTCODEC_END;
+    } else if (len) {
+        size_t i = 0;
+        if (decoder->hasPending) {
+            const int hi = hex_value((unsigned char)decoder->pending);
+            const int lo = hex_value((unsigned char)in[0]);
+            if (lo < 0) {
+                status = TEXTCODEC_MALFORMED;
+            } else {
+                out[n++] = (uint8_t)(hi << 4 | lo);
+                i = 1;
+            }
+        }
+        const size_t pairs = (len - i) & ~(size_t)1;
+        const bool odd = (len - i) & 1;
+        if (status == TEXTCODEC_SUCCESS &&
+            (!hex_decode_pairs(in + i, pairs, out + n) || (odd && hex_value((unsigned char)in[len - 1]) < 0))) {
+            status = TEXTCODEC_MALFORMED;
+        }
+        if (status == TEXTCODEC_SUCCESS) {
+            n += pairs / 2;
+            decoder->hasPending = odd;
+            decoder->pending = odd ? in[len - 1] : 0;
+        } else {
+            n = 0;
+        }
+    }
+    if (written) {
+        *written = n;
+    }
+    return status;
+}
+
+TextCodecStatus hex_decoderFinal(HexDecoder *decoder) {
+    if (!decoder) {
+        return TEXTCODEC_INVALID;
+    }
+    if (decoder->hasPending) {
+        return TEXTCODEC_MALFORMED;
+    }
+    hex_decoderInit(decoder);
+    return TEXTCODEC_SUCCESS;
+}
+
+void base64_encoderInit(Base64Encoder *encoder, Base64Variant variant) {
+    if (encoder) {
+        memset(encoder, 0, sizeof(*encoder));
+        encoder->variant = variant;
+    }
+}
+
+TextCodecStatus base64_encoderUpdate(Base64Encoder *encoder, const uint8_t src[], size_t len,
+                                     char out[], size_t outSize, size_t *written) {
+    size_t n = 0;
+    TextCodecStatus status = TEXTCODEC_SUCCESS;
+    if (!encoder || (!src && len) || (!out && outSize) || (unsigned)encoder->variant > BASE64_URL) {
+        status = TEXTCODEC_INVALID;
+    } else if (outSize < (encoder->count + len) / 3 * 4) {
+        status = TEXTCODEC_END;
+    } else if (encoder->count + len < 3) {
+        if (len) {
+            memcpy(encoder->pending + encoder->count, src, len);
+        }
+        encoder->count = (uint8_t)(encoder->count + len);
+    } else {
+        size_t i = 0;
+        if (encoder->count) {
+            uint8_t group[3];
+            memcpy(group, encoder->pending, encoder->count);
+            i = 3 - encoder->count;
+            memcpy(group + encoder->count, src, i);
+            n = base64_encode_groups(group, 3, out, encoder->variant);
+        }
+        const size_t whole = (len - i) / 3 * 3;
+        n += base64_encode_groups(src + i, whole, out + n, encoder->variant);
+        i += whole;
+        encoder->count = (uint8_t)(len - i);
+        memcpy(encoder->pending, src + i, encoder->count);
+    }
+    if (written) {
+        *written = n;
+    }
+    return status;
+}
+
+TextCodecStatus base64_encoderFinal(Base64Encoder *encoder, char out[], size_t outSize, size_t *written) {
+    size_t n = 0;
+    TextCodecStatus status = TEXTCODEC_SUCCESS;
+    if (!encoder || (!out && outSize) || (unsigned)encoder->variant > BASE64_URL) {
+        status = TEXTCODEC_INVALID;
+    } else if (encoder->count) {
+        if (outSize < base64_encodedSize(encoder->count, encoder->variant)) {
+            status = TEXTCODEC_END;
+        } else {
+            n = base64_encode_tail(encoder->pending, encoder->count, out, encoder->variant);
+        }
+    }
+    if (status == TEXTCODEC_SUCCESS) {
+        base64_encoderInit(encoder, encoder->variant);
+    }
+    if (written) {
+        *written = n;
+    }
+    return status;
+}
+
+void base64_decoderInit(Base64Decoder *decoder, Base64Variant variant) {
+    if (decoder) {
+        memset(decoder, 0, sizeof(*decoder));
+        decoder->variant = variant;
+    }
+}
+
+TextCodecStatus base64_decoderUpdate(Base64Decoder *decoder, const char in[], size_t len,
+                                     uint8_t out[], size_t outSize, size_t *written) {
+    size_t n = 0;
+    TextCodecStatus status = TEXTCODEC_SUCCESS;
+    if (!decoder || (!in && len) || (!out && outSize) || (unsigned)decoder->variant > BASE64_URL) {
+        status = TEXTCODEC_INVALID;
+    } else if (len && decoder->finished) {
+        status = TEXTCODEC_MALFORMED;
+    } else if (outSize < (decoder->count + len) / 4 * 3) {
+        status = TEXTCODEC_END;
+    } else if (decoder->count + len < 4) {
+        if (len) {
+            memcpy(decoder->pending + decoder->count, in, len);
+        }
+        decoder->count = (uint8_t)(decoder->count + len);
+    } else {
+        const Base64Variant variant = decoder->variant;
+        bool finished = false;
+        size_t i = 0;
+        base64_init_tables();
+        if (decoder->count) {
+            char group[4];
+            size_t produced;
+            memcpy(group, decoder->pending, decoder->count);
+            i = 4 - decoder->count;
+            memcpy(group + decoder->count, in, i);
+            if (!base64_decode_group(group, out, &produced, &finished, variant)) {
+                status = TEXTCODEC_MALFORMED;
+            }
+            n = produced;
+        }
+        size_t whole = finished ? 0 : (len - i) / 4 * 4;
+        if (status == TEXTCODEC_SUCCESS && whole) {
+            // only the last group of the chunk may carry padding
+            const char *last = in + i + whole - 4;
+            size_t produced = 0;
+            if (!base64_decode_groups(in + i, whole - 4, out + n, variant) ||
+                !base64_decode_group(last, out + n + (whole - 4) / 4 * 3, &produced, &finished, variant)) {
+                status = TEXTCODEC_MALFORMED;
+            }
+            n += (whole - 4) / 4 * 3 + produced;
+        }
+        i += whole;
+        if (status == TEXTCODEC_SUCCESS && finished && i < len) {
+            status = TEXTCODEC_MALFORMED; // text after the padding
+        }
+        if (status == TEXTCODEC_SUCCESS) {
+            decoder->count = (uint8_t)(len - i);
+            memcpy(decoder->pending, in + i, decoder->count);
+            decoder->finished = finished;
+        } else {
+            n = 0;
+        }
+    }
+    if (written) {
+        *written = n;
+    }
+    return status;
+}
+
+TextCodecStatus base64_decoderFinal(Base64Decoder *decoder, uint8_t out[], size_t outSize, size_t *written) {
+    size_t n = 0;
+    TextCodecStatus status = TEXTCODEC_SUCCESS;
+    if (!decoder || (!out && outSize) || (unsigned)decoder->variant > BASE64_URL) {
+        status = TEXTCODEC_INVALID;
+    } else if (decoder->count) {
+        base64_init_tables();
+        if (decoder->variant == BASE64_STANDARD || decoder->count == 1) {
+            status = TEXTCODEC_MALFORMED;
+        } else if (outSize < (size_t)decoder->count - 1) {
+            status = TEXTCODEC_END;
+        } else if (!base64_decode_tail(decoder->pending, decoder->count, out, decoder->variant)) {
+            status = TEXTCODEC_MALFORMED;
+        } else {
+            n = (size_t)decoder->count - 1;
+        }
+    }
+    if (status == TEXTCODEC_SUCCESS) {
+        base64_decoderInit(decoder, decoder->variant);
+    }
+    if (written) {
+        *written = n;
+    }
+    return status;
+}
@@ -0,0 +1,404 @@
+/*!
+ * \file varint.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Provides function implementations for the varint and zigzag codecs.
+ * \version 0.1
+ * \date 2026-10-16
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "varint.h"
+#include "once.h"
+#include "simd.h"
+#include <stdbool.h>
+#include <string.h>
+
+/*!
+ * \brief Macro for the scalar unsigned codecs of one width.
+ * \remarks The final byte of a maximum-length encoding may only use the bits that fit the type
+ * (4 for 32-bit, 1 for 64-bit), so every accepted encoding round-trips exactly.
+ */
+#define VARINT_UNSIGNED_DEFINE(NAME, T, MAX_BYTES) \
+size_t varint_size##NAME(T value) { \
+    size_t n = 1; \
+    while (value >= 0x80) { \
+        value >>= 7; \
+        ++n; \
+    } \
+    return n; \
+} \
+\
+size_t varint_encode##NAME(T value, uint8_t out[]) { \
+    size_t n = 0; \
+    while (value >= 0x80) { \
+        out[n++] = (uint8_t)(value | 0x80); \
+        value >>= 7; \
+    } \
+    out[n++] = (uint8_t)value; \
+    return n; \
+} \
+\
+VarintStatus varint_decode##NAME(const uint8_t in[], size_t inSize, T *value, size_t *consumed) { \
+    if (!in || !value) { \
+        return VARINT_INVALID; \
+    } \
+    T result = 0; \
+    size_t limit = (inSize < MAX_BYTES) ? inSize : MAX_BYTES; \
+    for (size_t i = 0; i < limit; ++i) { \
+        uint8_t byte = in[i]; \
+        if (i == MAX_BYTES - 1 && (byte >> (sizeof(T) * 8 - 7 * (MAX_BYTES - 1))) != 0) { \
+            return VARINT_OVERFLOW; \
+        } \
+        result |= (T)(byte & 0x7F) << (7 * i); \
+        if (!(byte & 0x80)) { \
+            *value = result; \
+            if (consumed) { \
+                *consumed = i + 1; \
+            } \
+            return VARINT_SUCCESS; \
+        } \
+    } \
+    return (limit == MAX_BYTES) ? VARINT_OVERFLOW : VARINT_END; \
+}
+
+    VARINT_UNSIGNED_DEFINE(UInt32, uint32_t, VARINT_MAX_BYTES_32)
+    VARINT_UNSIGNED_DEFINE(UInt64, uint64_t, VARINT_MAX_BYTES_64)
+
+#undef VARINT_UNSIGNED_DEFINE
+
+/*!
+ * \brief Macro for the signed (zigzag) single-value codecs, layered on the unsigned ones.
+ */
+#define VARINT_SIGNED_DEFINE(NAME, T, UNAME, UT, BITS) \
+size_t varint_size##NAME(T value) { \
+    return varint_size##UNAME(varint_zigzag##BITS(value)); \
+} \
+\
+size_t varint_encode##NAME(T value, uint8_t out[]) { \
+    return varint_encode##UNAME(varint_zigzag##BITS(value), out); \
+} \
+\
+VarintStatus varint_decode##NAME(const uint8_t in[], size_t inSize, T *value, size_t *consumed) { \
+    UT raw; \
+    if (!value) { \
+        return VARINT_INVALID; \
+    } \
+    VarintStatus status = varint_decode##UNAME(in, inSize, &raw, consumed); \
+    if (status == VARINT_SUCCESS) { \
+        *value = varint_unzigzag##BITS(raw); \
+    } \
+    return status; \
+}
+
+    VARINT_SIGNED_DEFINE(Int32, int32_t, UInt32, uint32_t, 32)
+    VARINT_SIGNED_DEFINE(Int64, int64_t, UInt64, uint64_t, 64)
+
+#undef VARINT_SIGNED_DEFINE
+
+/*!
+ * \brief Encodes a value below 2^56 without branching on its length.
+ * \remarks The length comes from the index h of the highest set bit as floor(h / 7) + 1 = (9h + 73) / 64.
+ * The 7-bit groups are spread into the low 7 bits of each byte of a word, the continuation bits of all
+ * but the last byte are set, and all 8 bytes are stored at once, so out needs 8 writable bytes.
+ */
+static inline size_t varint_encode_spread(uint64_t value, uint8_t out[]) {
+#if defined(__GNUC__) || defined(__clang__)
+    size_t len = ((size_t)(63 - __builtin_clzll(value | 1)) * 9 + 73) / 64;
+#else
+    size_t len = varint_sizeUInt64(value);
+#endif
+    uint64_t word = 0;
+    for (unsigned g = 0; g < 8; ++g) {
+        word |= (value & ((uint64_t)0x7F << (7 * g))) << g;
+    }
+    word |= UINT64_C(0x8080808080808080) & ((UINT64_C(1) << (8 * (len - 1))) - 1);
+    uint8_t bytes[8];
+    for (unsigned b = 0; b < 8; ++b) {
+        bytes[b] = (uint8_t)(word >> (8 * b));
+    }
+    memcpy(out, bytes, sizeof bytes);
+    return len;
+}
+
+/*!
+ * \brief Macro for the array encoders.
+ * \remarks Values are mapped through MAP (identity or zigzag) and encoded back to back.
+ * While at least 8 bytes of output remain, values for which SPREADS holds (those below 2^56)
+ * take \ref varint_encode_spread. 32-bit types always fit, so they pass a constant rather than
+ * a comparison that would always be true.
+ */
+#define VARINT_ENCODE_ARRAY_DEFINE(NAME, T, UT, UNAME, MAX_BYTES, MAP, SPREADS) \
+VarintStatus varint_encodeArray##NAME(const T src[], size_t count, uint8_t out[], size_t outSize, size_t *written) { \
+    if ((!src && count) || (!out && outSize)) { \
+        return VARINT_INVALID; \
+    } \
+    size_t pos = 0; \
+    VarintStatus status = VARINT_SUCCESS; \
+    for (size_t i = 0; i < count; ++i) { \
+        UT v = MAP(src[i]); \
+        if (outSize - pos >= 8 && SPREADS(v)) { \
+            pos += varint_encode_spread(v, out + pos); \
+            continue; \
+        } \
+        if (outSize - pos < MAX_BYTES && varint_size##UNAME(v) > outSize - pos) { \
+            status = VARINT_END; \
+            break; \
+        } \
+        pos += varint_encode##UNAME(v, out + pos); \
+    } \
+    if (written) { \
+        *written = pos; \
+    } \
+    return status; \
+}
+
+#define VARINT_IDENTITY(x) (x)
+#define VARINT_SPREADS_32(v) 1
+#define VARINT_SPREADS_64(v) ((v) < (UINT64_C(1) << 56))
+
+    VARINT_ENCODE_ARRAY_DEFINE(UInt32, uint32_t, uint32_t, UInt32, VARINT_MAX_BYTES_32, VARINT_IDENTITY, VARINT_SPREADS_32)
+    VARINT_ENCODE_ARRAY_DEFINE(UInt64, uint64_t, uint64_t, UInt64, VARINT_MAX_BYTES_64, VARINT_IDENTITY, VARINT_SPREADS_64)
+    VARINT_ENCODE_ARRAY_DEFINE(Int32, int32_t, uint32_t, UInt32, VARINT_MAX_BYTES_32, varint_zigzag32, VARINT_SPREADS_32)
+    VARINT_ENCODE_ARRAY_DEFINE(Int64, int64_t, uint64_t, UInt64, VARINT_MAX_BYTES_64, varint_zigzag64, VARINT_SPREADS_64)
+
+#undef VARINT_ENCODE_ARRAY_DEFINE
+#undef VARINT_SPREADS_32
+#undef VARINT_SPREADS_64
+
+#if CMOR_X86_SIMD
+/*!
+ * \brief pshufb controls gathering four varints of 1 to 4 bytes into separate 32-bit lanes.
+ * \remarks Indexed by the lengths of the four varints, two bits each (length - 1), lowest first.
+ * Lane i takes bytes [offset_i, offset_i + length_i) and zero-fills the rest.
+ * The table is spelled out by the preprocessor, so it is constant data with no initialization step.
+ */
+#define VARINT_LEN(c, i) ((((c) >> (2 * (i))) & 3) + 1)
+#define VARINT_OFF(c, i) (((i) > 0 ? VARINT_LEN(c, 0) : 0) + ((i) > 1 ? VARINT_LEN(c, 1) : 0) + \
+                          ((i) > 2 ? VARINT_LEN(c, 2) : 0))
+#define VARINT_SHUF_BYTE(c, i, j) ((j) < VARINT_LEN(c, i) ? VARINT_OFF(c, i) + (j) : 0x80)
+#define VARINT_SHUF_LANE(c, i) \
+    VARINT_SHUF_BYTE(c, i, 0), VARINT_SHUF_BYTE(c, i, 1), VARINT_SHUF_BYTE(c, i, 2), VARINT_SHUF_BYTE(c, i, 3)
+#define VARINT_SHUF(c) { VARINT_SHUF_LANE(c, 0), VARINT_SHUF_LANE(c, 1), VARINT_SHUF_LANE(c, 2), VARINT_SHUF_LANE(c, 3) }
+#define VARINT_SHUF4(c) VARINT_SHUF(c), VARINT_SHUF((c) + 1), VARINT_SHUF((c) + 2), VARINT_SHUF((c) + 3)
+#define VARINT_SHUF16(c) VARINT_SHUF4(c), VARINT_SHUF4((c) + 4), VARINT_SHUF4((c) + 8), VARINT_SHUF4((c) + 12)
+#define VARINT_SHUF64(c) VARINT_SHUF16(c), VARINT_SHUF16((c) + 16), VARINT_SHUF16((c) + 32), VARINT_SHUF16((c) + 48)
+
+static const uint8_t varint_shuffle[256][16] = {
+    VARINT_SHUF64(0), VARINT_SHUF64(64), VARINT_SHUF64(128), VARINT_SHUF64(192)
+};
+
+#undef VARINT_SHUF64
+#undef VARINT_SHUF16
+#undef VARINT_SHUF4
+#undef VARINT_SHUF
+#undef VARINT_SHUF_LANE
+#undef VARINT_SHUF_BYTE
+#undef VARINT_OFF
+#undef VARINT_LEN
+
+/*! Decoding of the next four varints, found from the terminator bits of the next 12 bytes */
+typedef struct {
+    uint8_t code; //!< index into \ref varint_shuffle
+    uint8_t bytes; //!< bytes the four varints occupy, or 0 if they do not all end within 12 bytes
+} VarintGroup;
+
+static VarintGroup varint_groups[1 << 12];
+
+/*!
+ * \brief Fills \ref varint_groups. A bit set in the index marks a byte that ends a varint.
+ * \remarks Looking the group up, rather than walking the terminator bits with ctz,
+ * keeps the dependency from one step's load to the next down to a movemask and a table load.
+ */
+static void varint_build_groups(void) {
+    for (unsigned mask = 0; mask < (1u << 12); ++mask) {
+        unsigned pos = 0, code = 0, k;
+        for (k = 0; k < 4; ++k) {
+            unsigned len = 1;
+            while (pos + len <= 12 && !(mask & (1u << (pos + len - 1)))) {
+                ++len;
+            }
+            if (pos + len > 12 || len > 4) {
+                break;
+            }
+            code |= (len - 1) << (2 * k);
+            pos += len;
+        }
+        varint_groups[mask].code = (uint8_t)code;
+        varint_groups[mask].bytes = (uint8_t)((k == 4) ? pos : 0);
+    }
+}
+
+static void varint_init_groups(void) {
+    static CmorOnce once = CMOR_ONCE_INIT;
+    cmor_once(&once, varint_build_groups);
+}
+
+/*!
+ * \brief Packs the 7-bit groups of up to four bytes in each 32-bit lane into one value.
+ * \remarks Doubling the odd bytes lets pmaddubsw form lo + 128 * hi in each 16-bit half,
+ * then pmaddwd forms lo16 + 16384 * hi16. Neither step can saturate.
+ */
+CMOR_TARGET("ssse3") static inline __m128i varint_pack_ssse3(__m128i lanes) {
+    const __m128i low7 = _mm_set1_epi8(0x7F);
+    const __m128i oddBytes = _mm_set1_epi16((short)0xFF00);
+    __m128i t = _mm_and_si128(lanes, low7);
+    t = _mm_add_epi8(t, _mm_and_si128(t, oddBytes));
+    t = _mm_maddubs_epi16(t, _mm_set1_epi16(0x4001));
+    return _mm_madd_epi16(t, _mm_set1_epi32(0x40000001));
+}
+
+/*!
+ * \brief Macro for the vectorized array decoder of one output width.
+ * \remarks Each step loads 16 bytes. With no continuation bits they are 16 one-byte values, widened directly.
+ * Otherwise, if the next four varints are each at most 4 bytes, one shuffle and \ref varint_pack_ssse3 decode them,
+ * with the lengths taken from \ref varint_groups when the four end within 12 bytes and from the terminator bits if not.
+ * Anything longer goes through the scalar decoder one value at a time. Steps only run while a whole
+ * 16-byte load stays inside the input, so the scalar decoder also finishes the tail.
+ * Returns the number of values decoded and stores the bytes consumed in *pos.
+ */
+#define VARINT_DECODE_SSSE3_DEFINE(NAME, T, STORE4) \
+CMOR_TARGET("ssse3") static size_t varint_decode_ssse3_##NAME(const uint8_t in[], size_t inSize, T dst[], \
+                                                              size_t count, size_t *pos) { \
+    const __m128i zero = _mm_setzero_si128(); \
+    size_t p = 0, i = 0; \
+    while (p + 16 <= inSize && i + 16 <= count) { \
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(in + p)); \
+        unsigned cont = (unsigned)_mm_movemask_epi8(bytes); \
+        if (cont == 0) { \
+            __m128i lo = _mm_unpacklo_epi8(bytes, zero), hi = _mm_unpackhi_epi8(bytes, zero); \
+            STORE4(dst + i, _mm_unpacklo_epi16(lo, zero)); \
+            STORE4(dst + i + 4, _mm_unpackhi_epi16(lo, zero)); \
+            STORE4(dst + i + 8, _mm_unpacklo_epi16(hi, zero)); \
+            STORE4(dst + i + 12, _mm_unpackhi_epi16(hi, zero)); \
+            p += 16; \
+            i += 16; \
+            continue; \
+        } \
+        VarintGroup group = varint_groups[~cont & 0xFFFu]; \
+        if (group.bytes) { \
+            __m128i shuf = _mm_loadu_si128((const __m128i *)varint_shuffle[group.code]); \
+            STORE4(dst + i, varint_pack_ssse3(_mm_shuffle_epi8(bytes, shuf))); \
+            p += group.bytes; \
+            i += 4; \
+            continue; \
+        } \
+        unsigned ends = ~cont; \
+        unsigned l0 = (unsigned)__builtin_ctz(ends); \
+        ends >>= l0 + 1; \
+        unsigned l1 = (unsigned)__builtin_ctz(ends); \
+        ends >>= l1 + 1; \
+        unsigned l2 = (unsigned)__builtin_ctz(ends); \
+        ends >>= l2 + 1; \
+        unsigned l3 = (unsigned)__builtin_ctz(ends); \
+        if ((l0 | l1 | l2 | l3) < 4) { \
+            __m128i shuf = _mm_loadu_si128((const __m128i *)varint_shuffle[l0 | l1 << 2 | l2 << 4 | l3 << 6]); \
+            STORE4(dst + i, varint_pack_ssse3(_mm_shuffle_epi8(bytes, shuf))); \
+            p += l0 + l1 + l2 + l3 + 4; \
+            i += 4; \
+        } else { \
+            size_t used; \
+            if (varint_decode##NAME(in + p, inSize - p, &dst[i], &used) != VARINT_SUCCESS) { \
+                break; \
+            } \
+            p += used; \
+            ++i; \
+        } \
+    } \
+    *pos = p; \
+    return i; \
+}
+
+#define VARINT_STORE4_32(dst, v) _mm_storeu_si128((__m128i *)(dst), (v))
+#define VARINT_STORE4_64(dst, v) \
+    (_mm_storeu_si128((__m128i *)(dst), _mm_unpacklo_epi32((v), _mm_setzero_si128())), \
+     _mm_storeu_si128((__m128i *)((dst) + 2), _mm_unpackhi_epi32((v), _mm_setzero_si128())))
+
+    VARINT_DECODE_SSSE3_DEFINE(UInt32, uint32_t, VARINT_STORE4_32)
+    VARINT_DECODE_SSSE3_DEFINE(UInt64, uint64_t, VARINT_STORE4_64)
+
+#undef VARINT_STORE4_32
+#undef VARINT_STORE4_64
+#undef VARINT_DECODE_SSSE3_DEFINE
+#endif // CMOR_X86_SIMD
+
+/*!
+ * \brief Macro for the unsigned array decoders: the vector kernel when available, then the scalar decoder.
+ */
+#define VARINT_DECODE_ARRAY_DEFINE(NAME, T) \
+VarintStatus varint_decodeArray##NAME(const uint8_t in[], size_t inSize, T dst[], size_t count, size_t *consumed) { \
+    if ((!in && inSize) || (!dst && count)) { \
+        return VARINT_INVALID; \
+    } \
+    size_t p = 0, i = 0; \
+    VarintStatus status = VARINT_SUCCESS; \
+    if (count > 0 && inSize > 0) { \
+        VARINT_DECODE_VECTOR(NAME); \
+    } \
+    for (; i < count; ++i) { \
+        size_t used; \
+        status = varint_decode##NAME(in + p, inSize - p, &dst[i], &used); \
+        if (status != VARINT_SUCCESS) { \
+            break; \
+        } \
+        p += used; \
+    } \
+    if (consumed) { \
+        *consumed = p; \
+    } \
+    return status; \
+}
+
+#if CMOR_X86_SIMD
+#define VARINT_DECODE_VECTOR(NAME) \
+    if (simd_level() >= SIMD_SSSE3) { \
+        varint_init_groups(); \
+        i = varint_decode_ssse3_##NAME(in, inSize, dst, count, &p); \
+    }
+#else
+#define VARINT_DECODE_VECTOR(NAME) (void)0
+#endif
+
+    VARINT_DECODE_ARRAY_DEFINE(UInt32, uint32_t)
+    VARINT_DECODE_ARRAY_DEFINE(UInt64, uint64_t)
+
+#undef VARINT_DECODE_VECTOR
+#undef VARINT_DECODE_ARRAY_DEFINE
+
+/*!
+ * \brief Macro for the signed array decoders: decode as unsigned in place, then undo the zigzag mapping.
+ * \remarks Signed and unsigned variants of a type may alias, and the second pass stays in cache
+ * for the block sizes used here.
+ */
+#define VARINT_DECODE_SIGNED_ARRAY_DEFINE(NAME, T, UNAME, UT, BITS) \
+VarintStatus varint_decodeArray##NAME(const uint8_t in[], size_t inSize, T dst[], size_t count, size_t *consumed) { \
+    const size_t block = 4096; \
+    size_t p = 0, i = 0; \
+    VarintStatus status = VARINT_SUCCESS; \
+    if ((!in && inSize) || (!dst && count)) { \
+        return VARINT_INVALID; \
+    } \
+    while (i < count) { \
+        size_t n = (count - i < block) ? count - i : block, used = 0; \
+        UT *raw = (UT *)(dst + i); \
+        status = varint_decodeArray##UNAME(in + p, inSize - p, raw, n, &used); \
+        p += used; \
+        if (status != VARINT_SUCCESS) { \
+            break; \
+        } \
+        for (size_t k = 0; k < n; ++k) { \
+            dst[i + k] = varint_unzigzag##BITS(raw[k]); \
+        } \
+        i += n; \
+    } \
+    if (consumed) { \
+        *consumed = p; \
+    } \
+    return status; \
+}
+
+    VARINT_DECODE_SIGNED_ARRAY_DEFINE(Int32, int32_t, UInt32, uint32_t, 32)
+    VARINT_DECODE_SIGNED_ARRAY_DEFINE(Int64, int64_t, UInt64, uint64_t, 64)
+
+#undef VARINT_DECODE_SIGNED_ARRAY_DEFINE
@@ -0,0 +1,31 @@
+/*!
+ * \file check.h
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Minimal assertion helpers for the ctest executables.
+ * \remarks Unlike assert these stay active in Release builds. A failed CHECK prints where it
+ * failed and marks the test failed; return CHECK_RESULT from main.
+ * \version 0.1
+ * \date 2026-10-17
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static int check_failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        check_failures++; \
+    } \
+} while (0)
+
+#define CHECK_RESULT (check_failures ? EXIT_FAILURE : EXIT_SUCCESS)
+
+#endif // CHECK_H
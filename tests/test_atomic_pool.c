@@ -0,0 +1,103 @@
+/*!
+ * \file test_atomic_pool.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief AtomicMemoryPool never hands one block to two threads and loses no blocks under contention.
+ * \version 0.1
+ * \date 2026-10-17
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "check.h"
+#include "mempool.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define THREADS 8
+#define BATCH 8
+#define BLOCK 64
+#define BLOCKS (THREADS * BATCH / 2 + 1) //!< fewer than the threads want, so they also race on exhaustion
+#define ROUNDS 20000
+
+static _Alignas(max_align_t) unsigned char buffer[BLOCKS * BLOCK];
+static AtomicMemoryPool pool;
+static atomic_size_t corrupt;
+
+static bool stamped(const unsigned char *block, unsigned char id) {
+    for (size_t i = 0; i < BLOCK; ++i) {
+        if (block[i] != id) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void churn(unsigned char id) {
+    unsigned char *held[BATCH];
+    for (size_t r = 0; r < ROUNDS; ++r) {
+        size_t count = 0;
+        while (count < BATCH && (held[count] = amp_alloc(&pool)) != NULL) {
+            memset(held[count++], id, BLOCK);
+        }
+        while (count > 0) {
+            unsigned char *block = held[--count];
+            if (!stamped(block, id)) {
+                atomic_fetch_add(&corrupt, 1);
+            }
+            amp_free(&pool, block);
+        }
+    }
+}
+
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+
+static int worker(void *arg) {
+    churn((unsigned char)(uintptr_t)arg);
+    return 0;
+}
+#endif
+
+int main(void) {
+    CHECK(amp_init(&pool, buffer, sizeof buffer, BLOCK, BLOCKS, NULL));
+    atomic_init(&corrupt, 0);
+
+#ifndef __STDC_NO_THREADS__
+    thrd_t threads[THREADS];
+    bool started[THREADS];
+    for (uintptr_t t = 0; t < THREADS; ++t) {
+        started[t] = thrd_create(&threads[t], worker, (void *)(t + 1)) == thrd_success;
+    }
+    for (size_t t = 0; t < THREADS; ++t) {
+        if (started[t]) {
+            thrd_join(threads[t], NULL);
+        } else {
+            churn((unsigned char)(t + 1));
+        }
+    }
+#else
+    churn(1);
+#endif
+
+    CHECK(atomic_load(&corrupt) == 0);
+    CHECK(amp_openBlocks(&pool) == BLOCKS);
+
+    // every block comes back exactly once, then the pool is empty
+    bool seen[BLOCKS] = { false };
+    for (size_t i = 0; i < BLOCKS; ++i) {
+        unsigned char *block = amp_alloc(&pool);
+        CHECK(block != NULL);
+        if (block) {
+            const size_t index = (size_t)(block - buffer) / BLOCK;
+            CHECK(index < BLOCKS);
+            if (index < BLOCKS) {
+                CHECK(!seen[index]);
+                seen[index] = true;
+            }
+        }
+    }
+    CHECK(amp_alloc(&pool) == NULL && amp_isEmpty(&pool));
+    return CHECK_RESULT;
+}
@@ -0,0 +1,76 @@
+/*!
+ * \file test_fir.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Blockwise FIR filtering reproduces one-shot convolve: exactly for integers, to rounding for long float kernels.
+ * \version 0.1
+ * \date 2026-10-17
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "array.h"
+#include "check.h"
+#include "fir.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SIGNAL 20000
+#define TAPS 1024
+#define OUT (SIGNAL + TAPS - 1)
+
+static uint32_t rng = 12345;
+
+static uint32_t next_random(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static int32_t xi[SIGNAL], hi[TAPS], yi[OUT], fi[OUT], statei[TAPS - 1];
+static double xd[SIGNAL], hd[TAPS], yd[OUT], direct[OUT], fd[OUT], stated[TAPS - 1];
+
+// uneven block sizes, so some blocks are shorter than the history and some longer
+static const size_t blocks[] = { 1, 7, 1023, 1024, 1025, 3000, 64 };
+
+#define FILTER_IN_BLOCKS(T, x, h, out, state) do { \
+    FirFilter_##T f; \
+    CHECK(fir_init(&f, h, TAPS, state, TAPS - 1) == FIR_SUCCESS); \
+    size_t done = 0; \
+    for (size_t b = 0; done < SIGNAL; b = (b + 1) % (sizeof blocks / sizeof blocks[0])) { \
+        const size_t n = blocks[b] < SIGNAL - done ? blocks[b] : SIGNAL - done; \
+        CHECK(fir_process(&f, x + done, out + done, n) == FIR_SUCCESS); \
+        done += n; \
+    } \
+    CHECK(fir_flush(&f, out + SIGNAL, TAPS - 1) == FIR_SUCCESS); \
+} while (0)
+
+int main(void) {
+    for (size_t i = 0; i < SIGNAL; ++i) {
+        xi[i] = (int32_t)(next_random() % 2001) - 1000;
+        xd[i] = (double)(int32_t)next_random() / 2147483648.0;
+    }
+    for (size_t i = 0; i < TAPS; ++i) {
+        hi[i] = (int32_t)(next_random() % 201) - 100;
+        hd[i] = (double)(int32_t)next_random() / 2147483648.0;
+    }
+
+    convolve(xi, SIGNAL, hi, TAPS, yi, OUT);
+    FILTER_IN_BLOCKS(int32_t, xi, hi, fi, statei);
+    CHECK(memcmp(yi, fi, sizeof yi) == 0);
+
+    CHECK(convolve_scratch_size(SIGNAL, TAPS) > 0); // long enough for convolve to take the FFT path
+    convolve(xd, SIGNAL, hd, TAPS, yd, OUT);
+    convolve_scratch(xd, SIGNAL, hd, TAPS, direct, OUT, NULL, 0);
+    FILTER_IN_BLOCKS(double, xd, hd, fd, stated);
+    CHECK(memcmp(direct, fd, sizeof fd) == 0);
+    size_t off = 0;
+    for (size_t i = 0; i < OUT; ++i) {
+        // each output sums at most TAPS products of magnitude below 1
+        off += fabs(yd[i] - fd[i]) > 1e-12;
+    }
+    CHECK(off == 0);
+    return CHECK_RESULT;
+}
@@ -0,0 +1,66 @@
+/*!
+ * \file test_magazine.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Initializing a MagazineCache twice on one thread neither leaks its blocks nor hangs the thread's exit.
+ * \version 0.1
+ * \date 2026-10-17
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "check.h"
+#include "magazine.h"
+
+#define BLOCK 64
+#define BLOCKS 256
+#define MAGAZINES 8
+
+static _Alignas(max_align_t) unsigned char buffer[BLOCKS * BLOCK];
+static AtomicMemoryPool pool;
+static Magazine magazines[MAGAZINES];
+static MagazineDepot depot;
+
+// leaves the caches holding partly filled magazines, so only draining puts their blocks back
+static void use_caches(MagazineCache *a, MagazineCache *b) {
+    CHECK(mc_init(a, &depot));
+    void *held = mc_alloc(a);
+    CHECK(held != NULL);
+    CHECK(mc_init(a, &depot)); // again, without draining in between
+    CHECK(mc_init(b, &depot));
+    mc_free(b, held);
+    CHECK(mc_alloc(a) != NULL && mc_alloc(b) != NULL);
+}
+
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+
+static int worker(void *arg) {
+    (void)arg;
+    static MagazineCache a, b; // static: the exit drains them after this frame is gone, and must finish
+    use_caches(&a, &b);
+    return 0;
+}
+#endif
+
+int main(void) {
+    CHECK(amp_init(&pool, buffer, sizeof buffer, BLOCK, BLOCKS, NULL));
+    CHECK(md_init(&depot, &pool, magazines, MAGAZINES));
+
+    MagazineCache a, b;
+    use_caches(&a, &b);
+    mc_drain(&a);
+    mc_drain(&b);
+    CHECK(amp_openBlocks(&pool) == BLOCKS - 2);
+    CHECK(amp_openBlocks(&depot.empty) == MAGAZINES);
+
+#ifndef __STDC_NO_THREADS__
+    thrd_t thread;
+    if (thrd_create(&thread, worker, NULL) == thrd_success) {
+        thrd_join(thread, NULL);
+        CHECK(amp_openBlocks(&pool) == BLOCKS - 4);
+        CHECK(amp_openBlocks(&depot.empty) == MAGAZINES);
+    }
+#endif
+    return CHECK_RESULT;
+}
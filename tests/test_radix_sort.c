@@ -0,0 +1,101 @@
+/*!
+ * \file test_radix_sort.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief Array_RadixSort gives the same total order (NaN, signed zeros) at every length, with or without scratch.
+ * \version 0.1
+ * \date 2026-10-17
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "array.h"
+#include "check.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*! \brief Whether a comes no later than b in the documented order: -NaN, -inf..-0, +0..+inf, +NaN. */
+static bool in_order(double a, double b) {
+    uint64_t x, y;
+    memcpy(&x, &a, sizeof x);
+    memcpy(&y, &b, sizeof y);
+    x = (x >> 63) ? ~x : x | (UINT64_C(1) << 63);
+    y = (y >> 63) ? ~y : y | (UINT64_C(1) << 63);
+    return x <= y;
+}
+
+static void check_sorted(const double *data, size_t len) {
+    for (size_t i = 1; i < len; ++i) {
+        CHECK(in_order(data[i - 1], data[i]));
+    }
+}
+
+static void check_doubles(size_t len, bool useScratch) {
+    static const double pattern[] = { 0.0, NAN, 1.0, -0.0, -1.0, 0.0, -0.0, 2.0, -NAN, INFINITY, -INFINITY };
+    double data[256], scratch[256];
+    for (size_t i = 0; i < len; ++i) {
+        data[i] = pattern[i % (sizeof pattern / sizeof pattern[0])] + (i >= 11 ? (double)(i % 7) - 3.0 : 0.0);
+    }
+    Array_RadixSort(data, len, useScratch ? scratch : NULL);
+    check_sorted(data, len);
+}
+
+/*! \brief -0.0 and +0.0 compare equal but must still come out with every -0.0 first. */
+static void check_signed_zeros(size_t len, bool useScratch) {
+    double data[256], scratch[256];
+    for (size_t i = 0; i < len; ++i) {
+        data[i] = (i % 2) ? -0.0 : 0.0;
+    }
+    Array_RadixSort(data, len, useScratch ? scratch : NULL);
+    for (size_t i = 0; i < len; ++i) {
+        CHECK(signbit(data[i]) == (i < len / 2));
+    }
+}
+
+#define LARGE 200000
+
+/*! \brief Without scratch a large array takes the introsort fallback and must match the radix output bit for bit. */
+static void check_large_without_scratch(void) {
+    static double withScratch[LARGE], without[LARGE], scratch[LARGE];
+    static const double specials[] = { NAN, -NAN, 0.0, -0.0, INFINITY, -INFINITY };
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    for (size_t i = 0; i < LARGE; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        withScratch[i] = (i % 97 == 0) ? specials[(i / 97) % 6] : (double)(int64_t)state / 1e12;
+    }
+    memcpy(without, withScratch, sizeof without);
+    Array_RadixSort(withScratch, LARGE, scratch);
+    Array_RadixSort(without, LARGE, NULL);
+    check_sorted(without, LARGE);
+    CHECK(memcmp(withScratch, without, sizeof without) == 0);
+}
+
+int main(void) {
+    double reported[] = { 0.0, NAN, 1.0, -0.0, -1.0, 0.0, -0.0, 2.0 };
+    Array_RadixSort(reported, 8, NULL);
+    CHECK(reported[0] == -1.0);
+    CHECK(signbit(reported[1]) && signbit(reported[2]));
+    CHECK(!signbit(reported[3]) && !signbit(reported[4]) && reported[4] == 0.0);
+    CHECK(reported[5] == 1.0 && reported[6] == 2.0 && isnan(reported[7]));
+
+    const size_t lengths[] = { 2, 3, 8, 11, 63, 64, 65, 200, 256 };
+    for (size_t i = 0; i < sizeof lengths / sizeof lengths[0]; ++i) {
+        check_doubles(lengths[i], true);
+        check_doubles(lengths[i], false);
+        check_signed_zeros(lengths[i], true);
+        check_signed_zeros(lengths[i], false);
+    }
+
+    check_large_without_scratch();
+
+    int32_t ints[] = { 5, -3, INT32_MIN, 0, INT32_MAX, -3, 7 };
+    Array_RadixSort(ints, 7, NULL);
+    for (size_t i = 1; i < 7; ++i) {
+        CHECK(ints[i - 1] <= ints[i]);
+    }
+    return CHECK_RESULT;
+}
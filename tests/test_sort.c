@@ -0,0 +1,87 @@
+/*!
+ * \file test_sort.c
+ * \author William (116991920+wdg0008@users.noreply.github.com)
+ * \brief The introsort engine behind Array_Sort, the selection routines, Array_ArgSort and SORT_BY_DEFINE.
+ * \version 0.1
+ * \date 2026-10-17
+ *
+ * \copyright Copyright (c) 2026
+ *
+ */
+
+#include "array.h"
+#include "check.h"
+#include <stdint.h>
+
+#define LEN 5000
+
+typedef struct {
+    int32_t key;
+    uint32_t id;
+} Record;
+
+#define RECORD_KEY(r) ((r).key)
+SORT_BY_DEFINE(Records_SortByKeyDescending, Record, RECORD_KEY, SORT_DESCENDING)
+
+static uint64_t state = 0x9E3779B97F4A7C15u;
+
+static uint32_t next_random(void) {
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return (uint32_t)((state * 0x2545F4914F6CDD1Du) >> 32);
+}
+
+/*! \brief Fills data with one of: random, few distinct values, sorted, reversed, all equal. */
+static void fill(int32_t data[], size_t len, int pattern) {
+    for (size_t i = 0; i < len; ++i) {
+        switch (pattern) {
+        case 0: data[i] = (int32_t)next_random(); break;
+        case 1: data[i] = (int32_t)(next_random() % 4); break;
+        case 2: data[i] = (int32_t)i; break;
+        case 3: data[i] = (int32_t)(len - i); break;
+        default: data[i] = 7; break;
+        }
+    }
+}
+
+int main(void) {
+    static int32_t data[LEN], copy[LEN];
+    static size_t indices[LEN];
+    const size_t lengths[] = { 0, 1, 2, 15, 16, 17, 128, 129, LEN };
+    for (size_t l = 0; l < sizeof lengths / sizeof lengths[0]; ++l) {
+        const size_t len = lengths[l];
+        for (int pattern = 0; pattern < 5; ++pattern) {
+            fill(data, len, pattern);
+            for (size_t i = 0; i < len; ++i) {
+                copy[i] = data[i];
+            }
+            Array_ArgSort(copy, len, indices);
+            Array_Sort(data, len);
+            for (size_t i = 1; i < len; ++i) {
+                CHECK(data[i - 1] <= data[i]);
+                // argsort is stable: equal keys keep their original order
+                CHECK(copy[indices[i - 1]] < copy[indices[i]] ||
+                      (copy[indices[i - 1]] == copy[indices[i]] && indices[i - 1] < indices[i]));
+            }
+            for (size_t i = 0; i < len; ++i) {
+                CHECK(copy[indices[i]] == data[i]);
+            }
+            if (len > 0) {
+                const size_t k = len / 3;
+                Array_NthElement(copy, len, k);
+                CHECK(copy[k] == data[k]);
+            }
+        }
+    }
+
+    static Record records[LEN];
+    for (size_t i = 0; i < LEN; ++i) {
+        records[i] = (Record){ (int32_t)(next_random() % 100), (uint32_t)i };
+    }
+    Records_SortByKeyDescending(records, LEN);
+    for (size_t i = 1; i < LEN; ++i) {
+        CHECK(records[i - 1].key >= records[i].key);
+    }
+    return CHECK_RESULT;
+}